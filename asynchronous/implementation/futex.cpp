@@ -0,0 +1,105 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/lightweight/futex.hpp"
+
+#include <climits>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <ctime>
+#endif
+
+//******************************************************************************
+using FutexWord = asynchronous::lightweight::FutexWord;
+
+static_assert( sizeof(std::atomic<FutexWord::value_t>) == sizeof(FutexWord::value_t),
+               "the futex syscall needs a plain 32bit word" );
+
+//******************************************************************************
+#if defined(__linux__)
+//******************************************************************************
+void FutexWord::sleep(value_t expected, const duration_t* timeout)
+{
+    timespec ts{};
+    timespec* tsPtr = nullptr;
+    if (timeout)
+    {
+        auto secs = std::chrono::duration_cast<std::chrono::seconds>(*timeout);
+        auto nsecs = std::chrono::duration_cast<std::chrono::nanoseconds>(*timeout - secs);
+        ts.tv_sec = static_cast<time_t>(secs.count());
+        ts.tv_nsec = static_cast<long>(nsecs.count());
+        tsPtr = &ts;
+    }
+    syscall(SYS_futex, static_cast<void*>(&ivValue), FUTEX_WAIT_PRIVATE, expected, tsPtr, nullptr, 0);
+}
+
+void FutexWord::wake()
+{
+    syscall(SYS_futex, static_cast<void*>(&ivValue), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+}
+
+//******************************************************************************
+#else
+//******************************************************************************
+// without a futex we can only poll
+void FutexWord::sleep(value_t, const duration_t*)
+{ std::this_thread::yield(); }
+
+void FutexWord::wake()
+{}
+
+//******************************************************************************
+#endif
+//******************************************************************************
+bool FutexWord::wait_until(value_t old, const timepoint_t& timepoint)
+{
+    if (ivValue.load() != old) { return true; }
+
+    ++ivSleepers;
+    bool result = true;
+    while (ivValue.load() == old)
+    {
+        auto now = clock_t::now();
+        if (now >= timepoint)
+        {
+            result = false;
+            break;
+        }
+        auto timeout = timepoint - now;
+        sleep(old, &timeout);
+    }
+    --ivSleepers;
+    return result;
+}
+
+void FutexWord::wait(value_t old)
+{
+    if (ivValue.load() != old) { return; }
+
+    ++ivSleepers;
+    while (ivValue.load() == old) { sleep(old, nullptr); }
+    --ivSleepers;
+}
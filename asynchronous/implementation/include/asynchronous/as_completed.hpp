@@ -0,0 +1,408 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/queue.hpp"
+#include "asynchronous/start_threads.hpp"
+
+#include <exception>
+#include <iterator>
+#include <optional>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+/**
+ * @brief the result of func on the element with the given index
+ *        either a value or the exception func has thrown
+ * @tparam T the return type of func
+ */
+template<typename T>
+struct Completed
+{
+    size_t              index = 0;
+    std::optional<T>    value;
+    std::exception_ptr  exception;
+
+    bool hasException() const { return static_cast<bool>(exception); }
+
+    /**
+     * @return the value, or rethrows the exception
+     * NOTE: the value is moved out, so call this only once
+     */
+    T get()
+    {
+        if (exception) { std::rethrow_exception(exception); }
+        return std::move(*value);
+    }
+};
+
+template<>
+struct Completed<void>
+{
+    size_t              index = 0;
+    std::exception_ptr  exception;
+
+    bool hasException() const { return static_cast<bool>(exception); }
+
+    /**
+     * @brief rethrows the exception, if there is one
+     */
+    void get()
+    {
+        if (exception) { std::rethrow_exception(exception); }
+    }
+};
+
+namespace details {
+//******************************************************************************
+
+/**
+ * @brief This class runs the function func for each element in the container
+ *        like ValueThreads, but hands out the results in the order
+ *        in which they are completed, through a Queue
+ * @tparam RESULT the return type of the function
+ * @tparam CONTAINER container type
+ * @tparam EXECUTOR void to start own threads, otherwise the executor (reference) to run on
+ */
+template<typename RESULT, typename CONTAINER, typename EXECUTOR = void>
+class CompletedValues
+{
+public:
+    using value_t = Completed< std::decay_t<RESULT> >;
+    using queue_t = SharedQueue<value_t>;
+    using reader_t = typename queue_t::reader_t;
+    using result_t = typename queue_t::result_t;
+
+private:
+    using values_t = CONTAINER;
+    using value_iterator = decltype( std::begin( std::declval<values_t&>() ));
+    using walker_t = PartitionWalker<value_iterator>;
+    using range_t = typename walker_t::Range;
+
+    /**
+     * NOTE: if the container was handed over as an rvalue,
+     *       it is kept here, so the iterators stay valid
+     */
+    struct SharedData
+    {
+        values_t    ivValues;
+        size_t      ivSize;
+        walker_t    ivWalker;
+
+        explicit SharedData(size_t threadCount, values_t&& values, const Partition& partition) :
+                ivValues(std::forward<values_t>(values)),
+                ivSize( (threadCount == 0) ? 0 : details::getSize(ivValues) ),
+                ivWalker(std::begin(ivValues), ivSize, std::min(threadCount, ivSize), partition)
+        {}
+    };
+
+    /**
+     * @brief The actual worker function
+     *        loops over the elements and pushes every result into the queue
+     *        NOTE: every worker holds a writer of the queue,
+     *              so the queue is finished when the last worker returns
+     */
+    template<typename FUNC, typename ... ARGS>
+    static void run(SharedData& sharedData, queue_t queue, FUNC&& func, ARGS&&... args)
+    {
+        sharedData.ivWalker.walk([&](const range_t& range)
+        {
+            auto index = range.offset;
+            for(auto valueIterator = range.first; valueIterator != range.last; ++valueIterator, ++index)
+            {
+                value_t completed;
+                completed.index = index;
+                try
+                {
+                    if constexpr( std::is_void_v<RESULT> )
+                    { std::invoke(func, *valueIterator, args...); }
+                    else
+                    { completed.value.emplace( std::invoke(func, *valueIterator, args...) ); }
+                }
+                catch(...)
+                { completed.exception = std::current_exception(); }
+
+                queue->push( std::move(completed) );
+            }
+        });
+    }
+
+    /**
+     * NOTE: the workers are joined, before the SharedData is destroyed!
+     */
+    std::unique_ptr<SharedData> ivSharedDataPtr;
+    reader_t                    ivQueue;
+    Workers<EXECUTOR>           ivThreads;
+
+    /**
+     * @brief start at most threadCount workers, but not more than elements
+     *        every worker gets its own copy of the writer
+     */
+    template<typename FUNC, typename ... ARGS>
+    void startWorkers(const queue_t& queue, size_t threadCount, FUNC&& func, ARGS&&... args)
+    {
+        threadCount = std::min(threadCount, size());
+        ivThreads.reserve( threadCount );
+        for(size_t i = 0; i < threadCount; ++i)
+        {
+            try
+            {
+                ivThreads.start(&CompletedValues::run<FUNC, ARGS...>,
+                                std::ref(*ivSharedDataPtr),
+                                queue,
+                                func,
+                                args...);
+            } catch(std::system_error&)
+            { /*ignore if we can not start the thread*/}
+        }
+    }
+
+    /**
+     * NOTE: the writer "queue" is dropped at the end of the constructor,
+     *       so only the workers keep the queue open
+     */
+    template<typename FUNC, typename ... ARGS>
+    explicit CompletedValues(queue_t queue, Workers<EXECUTOR>&& workers,
+                             size_t threadCount, values_t&& values, const Partition& partition,
+                             FUNC&& func, ARGS&&... args) :
+            ivSharedDataPtr( new SharedData{threadCount, std::forward<values_t>(values), partition} ),
+            ivQueue( queue.as_reader() ),
+            ivThreads( std::move(workers) )
+    {
+        startWorkers(queue, threadCount, std::forward<FUNC>(func), std::forward<ARGS>(args)...);
+    }
+
+public:
+    //--------------------------------------------------------------------------
+    /**
+     * @brief blocking input iterator over the completed results
+     */
+    class iterator
+    {
+    private:
+        CompletedValues*    ivOwner;
+        result_t            ivCurrent;
+
+        void next()
+        {
+            ivCurrent = ivOwner->pop();
+            if (not ivCurrent) { ivOwner = nullptr; }
+        }
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = value_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = value_t*;
+        using reference = value_t&;
+
+        explicit iterator(CompletedValues* owner = nullptr) :
+                ivOwner(owner),
+                ivCurrent()
+        { if (ivOwner) { next(); } }
+
+        reference operator * () { return ivCurrent.value; }
+        pointer operator -> () { return &ivCurrent.value; }
+
+        iterator& operator ++ () { next(); return *this; }
+
+        bool operator == (const iterator& other) const { return ivOwner == other.ivOwner; }
+        bool operator != (const iterator& other) const { return ivOwner != other.ivOwner; }
+    };
+
+    //--------------------------------------------------------------------------
+    /**
+     * @brief start all threads to push the results of func
+     *        on each element in values into the queue
+     * @param threadCount number of threads to run on
+     * @param values any container that supports std::begin, end
+     * @param partition how the elements are handed out to the threads
+     * @param func to be call on every element in values
+     * @param args extra parameters to func
+     */
+    template<typename FUNC, typename ... ARGS>
+    explicit CompletedValues(size_t threadCount, values_t&& values, const Partition& partition,
+                             FUNC&& func, ARGS&&... args) :
+            CompletedValues(queue_t{}, Workers<EXECUTOR>{},
+                            threadCount, std::forward<values_t>(values), partition,
+                            std::forward<FUNC>(func), std::forward<ARGS>(args)...)
+    {}
+
+    /**
+     * @brief same as above, but the workers are jobs run by the executor
+     *        NOTE: the executor has to outlive this object, if it was
+     *              handed over as an lvalue
+     */
+    template<typename EXEC, typename FUNC, typename ... ARGS>
+    explicit CompletedValues(EXEC&& executor, size_t threadCount, values_t&& values,
+                             const Partition& partition, FUNC&& func, ARGS&&... args) :
+            CompletedValues(queue_t{}, Workers<EXECUTOR>{ std::forward<EXEC>(executor) },
+                            threadCount, std::forward<values_t>(values), partition,
+                            std::forward<FUNC>(func), std::forward<ARGS>(args)...)
+    {}
+
+    CompletedValues(CompletedValues&&) = default;
+
+    /**
+     * if the results are abandoned, the workers stop to claim
+     * new elements and are joined
+     */
+    ~CompletedValues()
+    {
+        if (ivSharedDataPtr) { ivSharedDataPtr->ivWalker.stop(); }
+    }
+
+    /**
+     * blocks until the next result is completed
+     * @return the result, or PopResult::State::empty if all results were handed out
+     */
+    result_t pop() { return ivQueue->pop(); }
+
+    /**
+     * @return the next completed result,
+     *         or PopResult::State::empty if there is none right now
+     */
+    result_t try_pop() { return ivQueue->try_pop(); }
+
+    /**
+     * same as pop, but times out after duration
+     * @return PopResult with state = timeout if a timeout occurred
+     */
+    template<typename DURATION>
+    result_t pop_wait_for(const DURATION& duration)
+    { return ivQueue->pop_wait_for( std::chrono::duration_cast<typename queue_t::state_t::duration_t>(duration) ); }
+
+    /**
+     * NOTE: every result can be handed out only once,
+     *       so iterating twice yields only the results not popped yet
+     */
+    iterator begin() { return iterator{this}; }
+    iterator end() { return iterator{}; }
+
+    /**
+     * @return the number of results that will be handed out in total
+     */
+    size_t size() const { return ivSharedDataPtr->ivSize; }
+
+    auto threadCount() const { return ivThreads.size(); }
+};
+
+//******************************************************************************
+}  // namespace details
+
+/**
+ * @brief invokes the callable func on each element in the container
+ *        in parallel on at most threadCount threads, like invoke_on_each,
+ *        but the results are handed out in the order they are completed
+ *
+ * @example:
+ *     auto results = asynchronous::invoke_on_each_as_completed(4, requests, handle);
+ *     for(auto& completed : results)   // blocks only until the next result is there
+ *     { consume(completed.index, completed.get()); }
+ *
+ * @param threadCount number of threads to be used
+ *        NOTE: using 0 threads will not invoke the func at all
+ * @param partition how the elements are handed out to the threads
+ * @param container any container supporting std::begin/end
+ * @param func will be invoked on each element in the container, like
+ *        result = func(element, args...);
+ * @param args extra parameters to the func
+ * @return an object handing out Completed{index, value or exception}
+ */
+template<typename CONTAINER , typename FUNC, typename... ARGS,
+        typename VALUEITERATOR = decltype( std::begin( std::declval<CONTAINER>()) ) >
+inline auto invoke_on_each_as_completed(size_t threadCount, const Partition& partition,
+                                        CONTAINER&& container, FUNC&& func, ARGS&&... args)
+{
+    using VALUE = decltype( *(std::declval<VALUEITERATOR>()) );
+    using FUNC_RESULT = typename details::result_t<FUNC, VALUE, ARGS...>::type;
+    using VALUES = details::CompletedValues<FUNC_RESULT, CONTAINER>;
+
+    return VALUES {threadCount,
+                   std::forward<CONTAINER>(container),
+                   partition,
+                   std::forward<FUNC>(func),
+                   std::forward<ARGS>(args)...};
+}
+
+/**
+ * @brief see above, the partition is chosen automatically from the number of elements
+ */
+template<typename CONTAINER , typename FUNC, typename... ARGS,
+        typename = decltype( std::begin( std::declval<CONTAINER>()) ) >
+inline auto invoke_on_each_as_completed(size_t threadCount, CONTAINER&& container,
+                                        FUNC&& func, ARGS&&... args)
+{
+    return invoke_on_each_as_completed(threadCount,
+                                       Partition{},
+                                       std::forward<CONTAINER>(container),
+                                       std::forward<FUNC>(func),
+                                       std::forward<ARGS>(args)...);
+}
+
+/**
+ * @brief see above, but the work is done by threadCount jobs run on the executor
+ *        NOTE: if the executor is handed over as an lvalue,
+ *              it has to outlive the returned object
+ */
+template<typename EXECUTOR, typename CONTAINER , typename FUNC, typename... ARGS,
+        typename = enable_if_executor_t<EXECUTOR>,
+        typename VALUEITERATOR = decltype( std::begin( std::declval<CONTAINER>()) ) >
+inline auto invoke_on_each_as_completed(EXECUTOR&& executor, size_t threadCount, const Partition& partition,
+                                        CONTAINER&& container, FUNC&& func, ARGS&&... args)
+{
+    using VALUE = decltype( *(std::declval<VALUEITERATOR>()) );
+    using FUNC_RESULT = typename details::result_t<FUNC, VALUE, ARGS...>::type;
+    using VALUES = details::CompletedValues<FUNC_RESULT, CONTAINER, EXECUTOR>;
+
+    return VALUES {std::forward<EXECUTOR>(executor),
+                   threadCount,
+                   std::forward<CONTAINER>(container),
+                   partition,
+                   std::forward<FUNC>(func),
+                   std::forward<ARGS>(args)...};
+}
+
+/**
+ * @brief see above, the partition is chosen automatically from the number of elements
+ */
+template<typename EXECUTOR, typename CONTAINER , typename FUNC, typename... ARGS,
+        typename = enable_if_executor_t<EXECUTOR>,
+        typename = decltype( std::begin( std::declval<CONTAINER>()) ) >
+inline auto invoke_on_each_as_completed(EXECUTOR&& executor, size_t threadCount,
+                                        CONTAINER&& container, FUNC&& func, ARGS&&... args)
+{
+    return invoke_on_each_as_completed(std::forward<EXECUTOR>(executor),
+                                       threadCount,
+                                       Partition{},
+                                       std::forward<CONTAINER>(container),
+                                       std::forward<FUNC>(func),
+                                       std::forward<ARGS>(args)...);
+}
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
@@ -0,0 +1,154 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include <atomic>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+namespace details {
+//******************************************************************************
+
+/**
+ * @brief turns a callback based asynchronous call into an awaitable
+ *        that can be used with C++20 co_await, like
+ *            auto result = co_await queue->async_pop(executor);
+ *        This header does not need <coroutine>: the coroutine handle is
+ *        a template parameter and only its "resume" function is used,
+ *        so the library itself stays C++17.
+ *        If the result is available already (see TRY), the coroutine
+ *        continues without suspending. If the callback is called
+ *        before await_suspend returned (like with the InlineExecutor),
+ *        await_suspend returns false and the coroutine continues as well,
+ *        so it is never resumed from inside await_suspend.
+ * @tparam RESULT the type the callback is called with (or void)
+ * @tparam TRY callable as try(), that returns the result if it is available
+ *         already as std::optional<RESULT> (or true for void)
+ * @tparam REGISTER callable as register(callback), that arranges
+ *         for callback(RESULT) to be called exactly once
+ */
+template<typename RESULT, typename TRY, typename REGISTER>
+class CallbackAwaiter
+{
+private:
+    TRY                     ivTry;
+    REGISTER                ivRegister;
+    std::optional<RESULT>   ivResult;
+    std::atomic_bool        ivHandshake;    // set by the first of await_suspend and callback
+
+public:
+    CallbackAwaiter(TRY tryFunc, REGISTER reg) :
+        ivTry(std::move(tryFunc)),
+        ivRegister(std::move(reg)),
+        ivResult(),
+        ivHandshake(false)
+    {}
+
+    bool await_ready()
+    {
+        if (not ivResult) { ivResult = ivTry(); }
+        return ivResult.has_value();
+    }
+
+    template<typename HANDLE>
+    bool await_suspend(HANDLE handle)
+    {
+        ivRegister( [this, handle] (RESULT result) mutable
+                    {
+                        ivResult.emplace(std::move(result));
+                        // the second one continues the coroutine
+                        if (ivHandshake.exchange(true, std::memory_order_acq_rel)) { handle.resume(); }
+                    });
+
+        // once the callback ran, the coroutine might be gone:
+        // do not touch this after the exchange
+        return not ivHandshake.exchange(true, std::memory_order_acq_rel);
+    }
+
+    RESULT await_resume() { return std::move(*ivResult); }
+};
+
+template<typename TRY, typename REGISTER>
+class CallbackAwaiter<void, TRY, REGISTER>
+{
+private:
+    TRY                 ivTry;
+    REGISTER            ivRegister;
+    bool                ivDone;
+    std::atomic_bool    ivHandshake;    // set by the first of await_suspend and callback
+
+public:
+    CallbackAwaiter(TRY tryFunc, REGISTER reg) :
+        ivTry(std::move(tryFunc)),
+        ivRegister(std::move(reg)),
+        ivDone(false),
+        ivHandshake(false)
+    {}
+
+    bool await_ready()
+    {
+        if (not ivDone) { ivDone = ivTry(); }
+        return ivDone;
+    }
+
+    template<typename HANDLE>
+    bool await_suspend(HANDLE handle)
+    {
+        ivRegister( [this, handle] () mutable
+                    {
+                        ivDone = true;
+                        // the second one continues the coroutine
+                        if (ivHandshake.exchange(true, std::memory_order_acq_rel)) { handle.resume(); }
+                    });
+
+        // once the callback ran, the coroutine might be gone:
+        // do not touch this after the exchange
+        return not ivHandshake.exchange(true, std::memory_order_acq_rel);
+    }
+
+    void await_resume() const noexcept {}
+};
+
+/**
+ * NOTE: the awaiter is neither copyable nor movable,
+ *       it is returned by guaranteed copy elision
+ */
+template<typename RESULT, typename TRY, typename REGISTER>
+inline auto makeAwaiter(TRY&& tryFunc, REGISTER&& reg)
+{
+    return CallbackAwaiter< RESULT, std::decay_t<TRY>, std::decay_t<REGISTER> >(
+                std::forward<TRY>(tryFunc), std::forward<REGISTER>(reg) );
+}
+
+//******************************************************************************
+}  // namespace details
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
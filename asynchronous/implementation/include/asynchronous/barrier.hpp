@@ -95,6 +95,9 @@ public:
         if (locked_count_down(l))
         {
             reset(l);
+            auto ready = takeReadyWaiters(l);
+            l.unlock();
+            runWaiters(ready);
             return true;
         }
         return base_t::locked_wait_until(l, timepoint);
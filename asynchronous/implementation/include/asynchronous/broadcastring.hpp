@@ -0,0 +1,375 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/cappedqueue.hpp"
+#include "asynchronous/shared_resource.hpp"
+#include "asynchronous/lightweight/futex.hpp"
+#include "asynchronous/traits/cacheline.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+/**
+ * what a BroadcastRing does with a consumer, that is a full ring behind
+ */
+enum class Overflow
+{
+    backpressure,   //!< the writer waits for the slowest consumer
+    lagging         //!< the writer overwrites, the consumer loses the oldest items
+};
+
+template<typename STATE>
+class BroadcastConsumer;
+
+/**
+ * a ring buffer, that hands every item to every consumer (fan-out):
+ * every item is stored once, and every consumer has its own read cursor.
+ * The writers copy the items into the ring under an exclusive lock,
+ * the consumers copy them out under a shared lock, so they do not block each other.
+ * The consumers sleep on a futex word, that is bumped for every item.
+ * A consumer is created with subscribe() and gets the items pushed after that.
+ * The managed type has to be default constructable.
+ */
+template<typename T, size_t CAPACITY, Overflow ON_OVERFLOW = Overflow::backpressure>
+class basic_broadcast_ring : public std::enable_shared_from_this< basic_broadcast_ring<T, CAPACITY, ON_OVERFLOW> >
+{
+    static_assert(CAPACITY > 0, "the ring needs at least one slot");
+
+public:
+    using value_t = T;
+    using result_t = typename basic_capped_queue<T, CAPACITY>::PopResult;
+    using PopResult = result_t;
+    using consumer_t = BroadcastConsumer< basic_broadcast_ring >;
+
+    using clock_t = std::chrono::steady_clock;
+    using duration_t = clock_t::duration;
+    using timepoint_t = clock_t::time_point;
+
+    static constexpr size_t capacity = CAPACITY;
+    static constexpr Overflow overflow = ON_OVERFLOW;
+
+private:
+    friend consumer_t;
+
+    struct alignas(traits::cacheLineSize) Cursor
+    {
+        std::atomic<uint64_t> next{0};      // the sequence to read next
+        std::atomic<size_t>   lost{0};      // items overwritten before they were read
+    };
+
+    mutable std::shared_mutex   ivMutex;        // exclusive: write, subscribe; shared: read
+    std::vector<value_t>        ivSlots;
+    std::list<Cursor>           ivCursors;      // stable addresses
+    std::atomic<uint64_t>       ivWriteSeq;     // the number of items pushed
+    std::atomic<bool>           ivDone;
+
+    lightweight::FutexWord      ivPublished;    // bumped for every item and the finish
+    lightweight::FutexWord      ivConsumed;     // bumped by the consumers while a writer waits
+    std::atomic<size_t>         ivWaitingWriters;
+
+    /**
+     * @param synchronization object for this ring
+     * @return the lowest read cursor (or the write cursor without consumers)
+     */
+    uint64_t getSlowest(const std::unique_lock<std::shared_mutex>&) const
+    {
+        auto slowest = ivWriteSeq.load();
+        for(const auto& cursor : ivCursors) { slowest = std::min(slowest, cursor.next.load()); }
+        return slowest;
+    }
+
+    /**
+     * move the consumers, that would lose the slot of seq, to the oldest item kept
+     * @param synchronization object for this ring
+     */
+    void dropLagging(const std::unique_lock<std::shared_mutex>&, uint64_t seq)
+    {
+        const auto oldest = seq + 1 - capacity;
+        for(auto& cursor : ivCursors)
+        {
+            const auto next = cursor.next.load();
+            if (next >= oldest) { continue; }
+            cursor.lost.fetch_add(oldest - next);
+            cursor.next.store(oldest);
+        }
+    }
+
+    void consumed()
+    {
+        if (ivWaitingWriters.load() == 0) { return; }
+        ivConsumed.fetch_add(1);
+        ivConsumed.notify_all();
+    }
+
+    Cursor* subscribeCursor()
+    {
+        std::unique_lock<std::shared_mutex> l(ivMutex);
+        ivCursors.emplace_back();
+        ivCursors.back().next.store(ivWriteSeq.load());
+        return &ivCursors.back();
+    }
+
+    void unsubscribe(Cursor* cursor)
+    {
+        {
+            std::unique_lock<std::shared_mutex> l(ivMutex);
+            ivCursors.remove_if([cursor](const Cursor& c) { return &c == cursor; });
+        }
+        consumed();
+    }
+
+    PopResult try_pop(Cursor& cursor)
+    {
+        PopResult result{PopResult::State::empty};
+        {
+            std::shared_lock<std::shared_mutex> l(ivMutex);
+            const auto next = cursor.next.load();
+            if (next >= ivWriteSeq.load()) { return result; }
+
+            result = PopResult{ ivSlots[next % capacity] };
+            cursor.next.store(next + 1);
+        }
+        consumed();
+        return result;
+    }
+
+    PopResult pop(Cursor& cursor, const timepoint_t* timepoint)
+    {
+        while (true)
+        {
+            // done is set after the last push, so when it was seen, try_pop sees all items
+            const auto generation = ivPublished.load();
+            const bool done = isDone();
+            auto result = try_pop(cursor);
+            if (result.isValid() || done) { return result; }
+
+            if (timepoint == nullptr) { ivPublished.wait(generation); }
+            else if (not ivPublished.wait_until(generation, *timepoint))
+            { return PopResult{PopResult::State::timeout}; }
+        }
+    }
+
+public:
+    basic_broadcast_ring() :
+        ivMutex(),
+        ivSlots(capacity),
+        ivCursors(),
+        ivWriteSeq{0},
+        ivDone{false},
+        ivPublished(),
+        ivConsumed(),
+        ivWaitingWriters{0}
+    {}
+
+    /**
+     * destructor: signal all consumers to end
+     */
+    ~basic_broadcast_ring() { notifyToFinish(); }
+
+    /**
+     * sets done and wakes up all consumers and waiting writers
+     */
+    void notifyToFinish()
+    {
+        ivDone.store(true);
+        ivPublished.fetch_add(1);
+        ivPublished.notify_all();
+        ivConsumed.fetch_add(1);
+        ivConsumed.notify_all();
+    }
+
+    /**
+     * create a consumer, that gets every item pushed from now on
+     * NOTE: the ring must be owned by a Reader or Writer
+     * @return the consumer
+     */
+    consumer_t subscribe() { return consumer_t(this->shared_from_this(), subscribeCursor()); }
+
+    /**
+     * put a new item into the ring, with Overflow::backpressure it
+     * blocks as long as the slowest consumer is a full ring behind
+     * @param args to the constructor of the value
+     * @return false if the ring is finished
+     */
+    template<typename... ARGS>
+    bool push(ARGS&&... args)
+    {
+        std::unique_lock<std::shared_mutex> l(ivMutex);
+
+        if constexpr (overflow == Overflow::backpressure)
+        {
+            while (not isDone() && (getSlowest(l) + capacity <= ivWriteSeq.load()))
+            {
+                ivWaitingWriters.fetch_add(1);
+                const auto generation = ivConsumed.load();
+                const bool full = not isDone() && (getSlowest(l) + capacity <= ivWriteSeq.load());
+                l.unlock();
+                if (full) { ivConsumed.wait(generation); }
+                ivWaitingWriters.fetch_sub(1);
+                l.lock();
+            }
+        }
+
+        if (isDone()) { return false; }
+
+        const auto seq = ivWriteSeq.load();
+        if constexpr (overflow == Overflow::lagging)
+        {
+            if (seq >= capacity) { dropLagging(l, seq); }
+        }
+
+        ivSlots[seq % capacity] = value_t(std::forward<ARGS>(args)...);
+        ivWriteSeq.store(seq + 1);
+        l.unlock();
+
+        ivPublished.fetch_add(1);
+        ivPublished.notify_all();
+        return true;
+    }
+
+    /**
+     * @return true if the ring is closed for writers
+     */
+    bool isDone() const { return ivDone.load(); }
+
+    /**
+     * @return the number of items pushed so far
+     */
+    size_t getItemCount() const { return static_cast<size_t>(ivWriteSeq.load()); }
+
+    size_t getConsumerCount() const
+    {
+        std::shared_lock<std::shared_mutex> l(ivMutex);
+        return ivCursors.size();
+    }
+};
+
+//------------------------------------------------------------------------------
+/**
+ * the read cursor of one consumer of a basic_broadcast_ring,
+ * it keeps the ring alive and unsubscribes when destroyed
+ * NOTE: a consumer is meant to be used by one thread, it is movable
+ */
+template<typename STATE>
+class BroadcastConsumer
+{
+public:
+    using state_t = STATE;
+    using value_t = typename state_t::value_t;
+    using PopResult = typename state_t::PopResult;
+    using duration_t = typename state_t::duration_t;
+    using timepoint_t = typename state_t::timepoint_t;
+
+private:
+    using cursor_t = typename state_t::Cursor;
+
+    std::shared_ptr<state_t>    ivState;
+    cursor_t*                   ivCursor;
+
+    friend state_t;
+
+    BroadcastConsumer(std::shared_ptr<state_t> state, cursor_t* cursor) :
+        ivState(std::move(state)),
+        ivCursor(cursor)
+    {}
+
+public:
+    ~BroadcastConsumer()
+    {
+        if (ivState) { ivState->unsubscribe(ivCursor); }
+    }
+
+    BroadcastConsumer(BroadcastConsumer&& other) = default;
+    BroadcastConsumer& operator = (BroadcastConsumer&& other) = delete;
+
+    /**
+     * @return the next item, or State::empty if there is none (yet)
+     */
+    PopResult try_pop() { return ivState->try_pop(*ivCursor); }
+
+    /**
+     * blocks until there is a next item, or the ring is finished
+     * @return the item, or State::empty if the ring is finished
+     */
+    PopResult pop() { return ivState->pop(*ivCursor, nullptr); }
+
+    /**
+     * same as pop but times out when the timepoint is reached
+     * @return PopResult
+     *          -> state = timeout if a timeout occurred
+     */
+    PopResult pop_wait_until(const timepoint_t& timepoint) { return ivState->pop(*ivCursor, &timepoint); }
+
+    PopResult pop_wait_for(const duration_t& duration)
+    { return pop_wait_until(state_t::clock_t::now() + duration); }
+
+    /**
+     * @return the number of items, this consumer lost because it was lagging
+     *         (only with Overflow::lagging)
+     */
+    size_t getLostItemCount() const { return ivCursor->lost.load(); }
+
+    /**
+     * @return true if this consumer lost items
+     */
+    bool isLagging() const { return getLostItemCount() > 0; }
+
+    /**
+     * @return the number of items waiting for this consumer
+     */
+    size_t size() const
+    {
+        const auto next = static_cast<size_t>(ivCursor->next.load());
+        return ivState->getItemCount() - next;
+    }
+};
+
+//******************************************************************************
+/**
+ * the reading end of a broadcast ring: it can only subscribe consumers
+ * When the last writer is destroyed, all consumers' pop's return with State::empty
+ * (after the remaining items)
+ */
+template<typename T, size_t CAPACITY, Overflow ON_OVERFLOW = Overflow::backpressure>
+using BroadcastRing = asynchronous::Reader< asynchronous::basic_broadcast_ring<T, CAPACITY, ON_OVERFLOW> >;
+
+template<typename T, size_t CAPACITY, Overflow ON_OVERFLOW = Overflow::backpressure>
+using SharedBroadcastRing = asynchronous::Writer< asynchronous::basic_broadcast_ring<T, CAPACITY, ON_OVERFLOW> >;
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
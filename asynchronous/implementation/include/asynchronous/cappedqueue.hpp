@@ -24,22 +24,87 @@
 
 //******************************************************************************
 #include "asynchronous/shared_resource.hpp"
-
+#include "asynchronous/awaitable.hpp"
+#include "asynchronous/executor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
 #include <queue>
+#include <tuple>
 #include <mutex>
 #include <condition_variable>
 #include <chrono>
 #include <ostream>
+#include <vector>
 
 //******************************************************************************
 namespace asynchronous {
 //******************************************************************************
 
+namespace details {
+//******************************************************************************
+/**
+ * one notification object shared by several queues:
+ * every queue it is attached to bumps its generation,
+ * when a value was pushed or the queue was finished (see Selector)
+ */
+class QueueNotifier
+{
+public:
+    using clock_t = std::chrono::steady_clock;
+    using timepoint_t = clock_t::time_point;
+
+private:
+    std::mutex              ivMutex;
+    std::condition_variable ivCondition;
+    size_t                  ivGeneration{0};
+
+public:
+    void notify()
+    {
+        { std::lock_guard<std::mutex> l(ivMutex); ++ivGeneration; }
+        ivCondition.notify_all();
+    }
+
+    size_t getGeneration()
+    {
+        std::lock_guard<std::mutex> l(ivMutex);
+        return ivGeneration;
+    }
+
+    /**
+     * blocks until the generation changed or the timeout occurred
+     * @param generation the last seen generation
+     * @param timepoint when the timeout should occur (nullptr = never)
+     * @return false if a timeout occurred
+     */
+    bool wait(size_t generation, const timepoint_t* timepoint)
+    {
+        std::unique_lock<std::mutex> l(ivMutex);
+        auto changed = [this, generation]() { return ivGeneration != generation; };
+        if (timepoint == nullptr)
+        {
+            ivCondition.wait(l, changed);
+            return true;
+        }
+        return ivCondition.wait_until(l, *timepoint, changed);
+    }
+};
+
+//******************************************************************************
+}  // namespace details
+
 /**
  * This implements a thread-safe FIFO queue with a maximum capacity.
  * Every item that is pushed into this queue, already at max cap, is dropped.
  * The managed type has to be default constructable.
  * The function "pop" is blocking ("try_pop" is not).
+ * An item pushed with a deadline expires: the pop's skip it, once the deadline passed.
  */
 template<typename T, size_t MAXSIZE>
 class basic_capped_queue
@@ -49,12 +114,30 @@ public:
     using lock_t = std::unique_lock<mutex_t>;
 
     using value_t      = T;
-    using container_t  = std::queue<value_t>;
 
     using clock_t = std::chrono::steady_clock;
     using duration_t = clock_t::duration;
     using timepoint_t = clock_t::time_point;
 
+    static constexpr timepoint_t noDeadline = timepoint_t::max();
+
+    /**
+     * the value and the time it expires
+     */
+    struct Item
+    {
+        value_t     value;
+        timepoint_t deadline;
+
+        template<typename... ARGS>
+        explicit Item(const timepoint_t& d, ARGS&&... args) :
+            value(std::forward<ARGS>(args)...),
+            deadline(d)
+        {}
+    };
+
+    using container_t  = std::queue<Item>;
+
     static constexpr size_t maxsize = MAXSIZE;
 
     //--------------------------------------------------------------------------
@@ -113,27 +196,107 @@ public:
     };
 
     using result_t = PopResult;
+    using pop_callback_t = std::function<void(PopResult)>;
+    using expiry_callback_t = std::function<void(value_t)>;
 
 private:
     mutable mutex_t         ivMutex;
     std::condition_variable ivQueueCond;
+    std::condition_variable ivNotFullCond;
     bool                    ivDone{false};
     size_t                  ivItemCount{0};
     size_t                  ivDroppedItemCount{0};
+    size_t                  ivExpiredItemCount{0};
+    size_t                  ivDeadlineCount{0};     // queued items with a deadline
+    size_t                  ivCapacity{MAXSIZE};
+    size_t                  ivMaxQueueSize{0};
+    size_t                  ivWaitingPushers{0};
     container_t             ivQueue;
+    std::deque<pop_callback_t> ivAsyncPoppers;
+    std::vector<details::QueueNotifier*> ivNotifiers;
+    expiry_callback_t       ivExpiryCallback;
+
+    /**
+     * the number of asynchronous poppers and notifiers,
+     * notify_all takes the lock only if there are any
+     */
+    std::atomic<size_t>     ivListenerCount{0};
+
+    /**
+     * remove the first item
+     * @param synchronization object for this queue
+     */
+    void popFront(const lock_t&)
+    {
+        if (ivQueue.front().deadline != noDeadline) { --ivDeadlineCount; }
+        ivQueue.pop();
+    }
+
+    /**
+     * skip the expired items at the front of the queue,
+     * they are destroyed in place unless there is an expiry callback
+     * @param synchronization object for this queue
+     */
+    void dropExpired(const lock_t& l)
+    {
+        if (ivDeadlineCount == 0) { return; }
+
+        const auto now = clock_t::now();
+        const auto before = ivExpiredItemCount;
+        while ( (not ivQueue.empty()) && (ivQueue.front().deadline <= now) )
+        {
+            ++ivExpiredItemCount;
+            if (ivExpiryCallback) { ivExpiryCallback(std::move(ivQueue.front().value)); }
+            popFront(l);
+        }
+        if ( (ivExpiredItemCount != before) && (ivWaitingPushers > 0) ) { ivNotFullCond.notify_all(); }
+    }
+
+    /**
+     * tell the attached notifiers about a new value or the finish
+     * @param synchronization object for this queue
+     */
+    void notifyNotifiers(const lock_t&)
+    {
+        for(auto* notifier : ivNotifiers) { notifier->notify(); }
+    }
 
     /**
      * check if pop() should wait on the queue for further steps
      * @param synchronization object for this queue
      * @return true if the worker should wait
      */
-    bool shouldWait(const lock_t& l) const
+    bool shouldWait(const lock_t& l)
     {
+        dropExpired(l);
         if (isDone(l)) return false;
         if (ivQueue.empty()) return true;
         return false;
     }
 
+    /**
+     * hand the queued values (or the "finished" state)
+     * to the registered asynchronous consumers
+     * NOTE: the callbacks are called without holding the lock
+     */
+    void dispatchAsyncPoppers()
+    {
+        while (true)
+        {
+            auto l = getLock();
+            if (ivAsyncPoppers.empty()) { return; }
+            if (shouldWait(l)) { return; }
+
+            auto callback = std::move(ivAsyncPoppers.front());
+            ivAsyncPoppers.pop_front();
+            --ivListenerCount;
+            auto result = try_pop(l);
+            l.unlock();
+
+            callback(std::move(result));
+        }
+    }
+
 public:
     /**
      * @return synchronization object for this queue
@@ -142,16 +305,38 @@ public:
 
     /**
      * notify all consumers
+     * NOTE: with attached Selectors or asynchronous consumers (when_popped)
+     *       this takes the lock, so call notify_all(lock) while holding it
+     */
+    void notify_all()
+    {
+        ivQueueCond.notify_all();
+        if (ivListenerCount.load() == 0) { return; }
+
+        { auto l = getLock(); notifyNotifiers(l); }
+        dispatchAsyncPoppers();
+    }
+
+    /**
+     * same as above, but while holding the lock:
+     * the asynchronous consumers (when_popped) are not served from here,
+     * they get the values with the next push or notify_all()
+     * @param synchronization object for this queue
      */
-    void notify_all() { ivQueueCond.notify_all(); }
+    void notify_all(const lock_t& l)
+    {
+        notifyNotifiers(l);
+        ivQueueCond.notify_all();
+    }
 
     /**
-     * sets ivDone and notifies all consumers to end
+     * sets ivDone and notifies all consumers and waiting producers to end
      */
     void notifyToFinish()
     {
         { auto l = getLock(); ivDone = true; }
         notify_all();
+        ivNotFullCond.notify_all();
     }
 
     /**
@@ -161,16 +346,19 @@ public:
 
     //--------------------------------------------------------------------------
     /**
-     * @return the next element in the queue
+     * @return the next element in the queue, expired items are skipped
      *         if the queue is empty, it returns PopResult::State::empty
      * @param synchronization object for this queue
      */
-    PopResult try_pop(const lock_t&)
+    PopResult try_pop(const lock_t& l)
     {
+        dropExpired(l);
         if (ivQueue.empty()) { return PopResult{PopResult::State::empty}; }
 
-        PopResult result{std::move(ivQueue.front())};
-        ivQueue.pop();
+        PopResult result{std::move(ivQueue.front().value)};
+        popFront(l);
+
+        if (ivWaitingPushers > 0) { ivNotFullCond.notify_one(); }
         return result;
     }
 
@@ -256,16 +444,29 @@ public:
      */
     template<typename... ARGS>
     bool push_no_notify(const lock_t& l, ARGS&&... args)
+    { return push_with_deadline_no_notify(l, noDeadline, std::forward<ARGS>(args)...); }
+
+    /**
+     * same as push_no_notify, but the item expires at the deadline
+     * @param synchronization object for this queue
+     * @param deadline when the item expires
+     * @param args to the constructor of value
+     */
+    template<typename... ARGS>
+    bool push_with_deadline_no_notify(const lock_t& l, const timepoint_t& deadline, ARGS&&... args)
     {
         ++ivItemCount;
 
+        if (full(l)) { dropExpired(l); }
         if (isDone(l) || full(l) )
         {
             ++ivDroppedItemCount;
             return false;
         }
 
-        ivQueue.emplace(std::forward<ARGS>(args)...);
+        ivQueue.emplace(deadline, std::forward<ARGS>(args)...);
+        if (deadline != noDeadline) { ++ivDeadlineCount; }
+        ivMaxQueueSize = std::max(ivMaxQueueSize, ivQueue.size());
         return true;
     }
 
@@ -280,12 +481,156 @@ public:
      */
     template<typename... ARGS>
     bool push(ARGS&&... args)
+    { return push_with_deadline(noDeadline, std::forward<ARGS>(args)...); }
+
+    /**
+     * same as push, but the item expires at the deadline:
+     * if it is still queued then, the pop's skip it
+     * and count it as expired (see getExpiredItemCount)
+     * @param deadline when the item expires
+     * @param args to the constructor of value
+     */
+    template<typename... ARGS>
+    bool push_with_deadline(const timepoint_t& deadline, ARGS&&... args)
+    {
+        auto l = getLock();
+        auto result = push_with_deadline_no_notify(l, deadline, std::forward<ARGS>(args)...);
+        const bool hasAsyncPoppers = not ivAsyncPoppers.empty();
+        notifyNotifiers(l);
+        l.unlock();
+
+        ivQueueCond.notify_one();
+        if (hasAsyncPoppers) { dispatchAsyncPoppers(); }
+        return result;
+    }
+
+    /**
+     * same as push, but instead of dropping the value
+     * it blocks as long as the queue is full
+     * @return true if a new value was created and enqueued.
+     * @return false if the queue is finished
+     * @param args to the constructor of value
+     */
+    template<typename... ARGS>
+    bool push_wait(ARGS&&... args)
     {
-        auto result = push_no_notify(getLock(),std::forward<ARGS>(args)...);
+        auto l = getLock();
+
+        ++ivWaitingPushers;
+        while( full(l) && not isDone(l) )
+        {
+            try { ivNotFullCond.wait(l); }
+            catch(...) {}
+        }
+        --ivWaitingPushers;
+
+        auto result = push_no_notify(l, std::forward<ARGS>(args)...);
+        const bool hasAsyncPoppers = not ivAsyncPoppers.empty();
+        notifyNotifiers(l);
+        l.unlock();
+
         ivQueueCond.notify_one();
+        if (hasAsyncPoppers) { dispatchAsyncPoppers(); }
         return result;
     }
 
+    /**
+     * pop the next value without blocking the calling thread:
+     * the callback is called with the PopResult as soon as a value
+     * is available or the queue is finished (then with State::empty).
+     * The callback is run by the executor.
+     * NOTE: values pushed with push_no_notify are only handed out
+     *       with the next notify_all() without the lock (or push)
+     * @param executor the callback is executed on
+     * @param callback called as callback(PopResult)
+     */
+    template<typename EXECUTOR, typename CALLBACK>
+    void when_popped(EXECUTOR&& executor, CALLBACK&& callback)
+    {
+        {
+            auto l = getLock();
+            ++ivListenerCount;
+            ivAsyncPoppers.emplace_back(
+                [exec = std::tuple<EXECUTOR>(std::forward<EXECUTOR>(executor)),
+                 callback = std::forward<CALLBACK>(callback)] (PopResult result) mutable
+                {
+                    auto shared = std::make_shared<PopResult>(std::move(result));
+                    std::get<0>(exec).execute( [callback, shared] () mutable
+                                               { callback(std::move(*shared)); } );
+                });
+        }
+        dispatchAsyncPoppers();
+    }
+
+    /**
+     * awaitable version of pop for C++20 coroutines:
+     *      auto result = co_await queue->async_pop(executor);
+     * if a value is available already (or the queue is finished),
+     * the coroutine continues without suspending; otherwise it is resumed
+     * on the executor, the default resumes it in the thread that pushed the value
+     * @param executor the coroutine is resumed on
+     * @return an awaitable returning the PopResult
+     */
+    template<typename EXECUTOR = InlineExecutor>
+    auto async_pop(EXECUTOR&& executor = EXECUTOR{})
+    {
+        return details::makeAwaiter<PopResult>(
+            [this] () -> std::optional<PopResult>
+            {
+                auto l = getLock();
+                if (shouldWait(l)) { return std::nullopt; }
+                return try_pop(l);
+            },
+            [this, exec = std::tuple<EXECUTOR>(std::forward<EXECUTOR>(executor))]
+            (auto callback) mutable
+            { when_popped(std::forward<EXECUTOR>(std::get<0>(exec)), std::move(callback)); } );
+    }
+
+    /**
+     * the notifier is told about every push and the finish of this queue
+     * until it is detached again (see Selector)
+     * @param notifier
+     */
+    void attachNotifier(details::QueueNotifier* notifier)
+    {
+        auto l = getLock();
+        ivNotifiers.push_back(notifier);
+        ++ivListenerCount;
+    }
+
+    void detachNotifier(details::QueueNotifier* notifier)
+    {
+        auto l = getLock();
+        auto it = std::remove(ivNotifiers.begin(), ivNotifiers.end(), notifier);
+        ivListenerCount -= static_cast<size_t>(std::distance(it, ivNotifiers.end()));
+        ivNotifiers.erase(it, ivNotifiers.end());
+    }
+
+    /**
+     * the callback gets the expired items (instead of destroying them)
+     * NOTE: it is called with the lock held, so it must not use this queue
+     * @param synchronization object for this queue
+     * @param callback called as callback(value)
+     */
+    void setExpiryCallback(const lock_t&, expiry_callback_t callback)
+    { ivExpiryCallback = std::move(callback); }
+
+    void setExpiryCallback(expiry_callback_t callback)
+    { setExpiryCallback(getLock(), std::move(callback)); }
+
+    /**
+     * limit the capacity of this queue at runtime
+     * @param synchronization object for this queue
+     * @param capacity the new capacity, at most maxsize
+     */
+    void setCapacity(const lock_t&, size_t capacity)
+    {
+        ivCapacity = std::min(capacity, maxsize);
+        ivNotFullCond.notify_all();
+    }
+
+    void setCapacity(size_t capacity) { setCapacity(getLock(), capacity); }
+
     //--------------------------------------------------------------------------
     /**
      * provide the queue state functions
@@ -302,15 +647,25 @@ public:
      */
     bool full(const lock_t&) const
     {
-        if (ivQueue.size() < maxsize) return false;
+        if (ivQueue.size() < ivCapacity) return false;
         return true;
     }
 
+    /**
+     * NOTE: empty and size include the expired items, that were not skipped yet
+     */
     bool empty(const lock_t&)  const { return ivQueue.empty(); }
     size_t size(const lock_t&) const { return ivQueue.size(); }
 
     size_t getItemCount(const lock_t&) const { return ivItemCount; }
     size_t getDroppedItemCount(const lock_t&) const { return ivDroppedItemCount; }
+    size_t getExpiredItemCount(const lock_t&) const { return ivExpiredItemCount; }
+    size_t getCapacity(const lock_t&) const { return ivCapacity; }
+
+    /**
+     * @return the maximum number of elements that were in the queue at once
+     */
+    size_t getMaxQueueSize(const lock_t&) const { return ivMaxQueueSize; }
 
     //--------------------------------------------------------------------------
     bool isDone() const { return isDone(getLock()); }
@@ -320,6 +675,9 @@ public:
 
     size_t getItemCount() const { return getItemCount(getLock()); }
     size_t getDroppedItemCount() const { return getDroppedItemCount(getLock()); }
+    size_t getExpiredItemCount() const { return getExpiredItemCount(getLock()); }
+    size_t getCapacity() const { return getCapacity(getLock()); }
+    size_t getMaxQueueSize() const { return getMaxQueueSize(getLock()); }
 };
 
 //******************************************************************************
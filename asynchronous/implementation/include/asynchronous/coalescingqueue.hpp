@@ -0,0 +1,276 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/cappedqueue.hpp"
+#include "asynchronous/shared_resource.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+/**
+ * This implements a thread-safe FIFO queue of keyed values,
+ * where only the latest value per key matters:
+ * pushing a key, that is still queued, replaces its value in place
+ * (the key keeps its place in the queue) and counts as merged.
+ * So the queue never holds more items than distinct keys.
+ * The pop's return the key and the value as std::pair.
+ * The managed types have to be default constructable.
+ * The function "pop" is blocking ("try_pop" is not).
+ */
+template<typename KEY, typename T, typename HASH = std::hash<KEY> >
+class basic_coalescing_queue
+{
+public:
+    using mutex_t = std::mutex;
+    using lock_t = std::unique_lock<mutex_t>;
+
+    using key_t        = KEY;
+    using mapped_t     = T;
+    using value_t      = std::pair<key_t, mapped_t>;
+    using container_t  = std::list<value_t>;
+    using index_t      = std::unordered_map<key_t, typename container_t::iterator, HASH>;
+
+    using clock_t = std::chrono::steady_clock;
+    using duration_t = clock_t::duration;
+    using timepoint_t = clock_t::time_point;
+
+    using PopResult = typename basic_capped_queue<value_t, std::numeric_limits<size_t>::max()>::PopResult;
+    using result_t = PopResult;
+
+private:
+    mutable mutex_t         ivMutex;
+    std::condition_variable ivQueueCond;
+    bool                    ivDone{false};
+    size_t                  ivItemCount{0};
+    size_t                  ivMergedItemCount{0};
+    size_t                  ivMaxQueueSize{0};
+    container_t             ivQueue;
+    index_t                 ivIndex;
+
+    /**
+     * check if pop() should wait on the queue for further steps
+     * @param synchronization object for this queue
+     * @return true if the worker should wait
+     */
+    bool shouldWait(const lock_t& l) const
+    {
+        if (isDone(l)) return false;
+        if (ivQueue.empty()) return true;
+        return false;
+    }
+
+public:
+    basic_coalescing_queue() = default;
+
+    /**
+     * @return synchronization object for this queue
+     */
+    lock_t getLock() const { return lock_t{ivMutex}; }
+
+    /**
+     * notify all consumers
+     */
+    void notify_all() { ivQueueCond.notify_all(); }
+
+    /**
+     * sets ivDone and notifies all consumers to end
+     */
+    void notifyToFinish()
+    {
+        { auto l = getLock(); ivDone = true; }
+        notify_all();
+    }
+
+    /**
+     * destructor: signal all consumers to end
+     */
+    ~basic_coalescing_queue() { notifyToFinish(); }
+
+    //--------------------------------------------------------------------------
+    /**
+     * @return the oldest queued key with its latest value
+     *         if the queue is empty, it returns PopResult::State::empty
+     * @param synchronization object for this queue
+     */
+    PopResult try_pop(const lock_t&)
+    {
+        if (ivQueue.empty()) { return PopResult{PopResult::State::empty}; }
+
+        ivIndex.erase(ivQueue.front().first);
+        PopResult result{std::move(ivQueue.front())};
+        ivQueue.pop_front();
+        return result;
+    }
+
+    PopResult try_pop() { return try_pop(getLock()); }
+
+    /**
+     * blocks until at least one value was en-queued
+     * or the queue is finished
+     * @return the value, or PopResult::State::empty if the queue is finished
+     */
+    PopResult pop()
+    {
+        auto l = getLock();
+
+        while( shouldWait(l) )
+        {
+            try { ivQueueCond.wait(l); }
+            catch(...) {}
+        }
+
+        return try_pop(l);
+    }
+
+    /**
+     * same as pop but times out when the timepoint is reached
+     * @param timepoint
+     * @return PopResult
+     *          -> state = timeout if a timeout occurred
+     */
+    PopResult pop_wait_until(const timepoint_t& end)
+    {
+        auto l = getLock();
+        while (shouldWait(l))
+        {
+            try
+            {
+                if (ivQueueCond.wait_until(l, end) ==  std::cv_status::timeout)
+                { return PopResult{ PopResult::State::timeout }; }
+            }
+            catch(...) {}
+        }
+        return try_pop(l);
+    }
+
+    PopResult pop_wait_for(const duration_t& duration)
+    { return pop_wait_until( clock_t::now() + duration ); }
+
+    /**
+     * en-queue the key, or replace its value if it is still queued
+     * @return false if the queue is finished (the value is dropped)
+     * @param synchronization object for this queue
+     * @param key
+     * @param args to the constructor of the value
+     */
+    template<typename... ARGS>
+    bool push_no_notify(const lock_t& l, const key_t& key, ARGS&&... args)
+    {
+        if (isDone(l)) { return false; }
+        ++ivItemCount;
+
+        auto found = ivIndex.find(key);
+        if (found != ivIndex.end())
+        {
+            found->second->second = mapped_t(std::forward<ARGS>(args)...);
+            ++ivMergedItemCount;
+            return true;
+        }
+
+        ivQueue.emplace_back(std::piecewise_construct,
+                             std::forward_as_tuple(key),
+                             std::forward_as_tuple(std::forward<ARGS>(args)...));
+        ivIndex.emplace(key, std::prev(ivQueue.end()));
+        ivMaxQueueSize = std::max(ivMaxQueueSize, ivQueue.size());
+        return true;
+    }
+
+    /**
+     * en-queue the key, or replace its value if it is still queued,
+     * and notify one consumer
+     * @return false if the queue is finished (the value is dropped)
+     * @param key
+     * @param args to the constructor of the value
+     */
+    template<typename... ARGS>
+    bool push(const key_t& key, ARGS&&... args)
+    {
+        auto l = getLock();
+        auto result = push_no_notify(l, key, std::forward<ARGS>(args)...);
+        l.unlock();
+
+        ivQueueCond.notify_one();
+        return result;
+    }
+
+    //--------------------------------------------------------------------------
+    /**
+     * provide the queue state functions
+     */
+    bool isDone(const lock_t&) const { return ivDone; }
+    bool empty(const lock_t&)  const { return ivQueue.empty(); }
+    size_t size(const lock_t&) const { return ivQueue.size(); }
+
+    /**
+     * @return the number of pushes
+     */
+    size_t getItemCount(const lock_t&) const { return ivItemCount; }
+
+    /**
+     * @return the number of pushes, that replaced a queued value
+     */
+    size_t getMergedItemCount(const lock_t&) const { return ivMergedItemCount; }
+
+    /**
+     * @return the maximum number of keys that were in the queue at once
+     */
+    size_t getMaxQueueSize(const lock_t&) const { return ivMaxQueueSize; }
+
+    //--------------------------------------------------------------------------
+    bool isDone() const { return isDone(getLock()); }
+    bool empty()  const { return empty(getLock()); }
+    size_t size() const { return size(getLock()); }
+
+    size_t getItemCount() const { return getItemCount(getLock()); }
+    size_t getMergedItemCount() const { return getMergedItemCount(getLock()); }
+    size_t getMaxQueueSize() const { return getMaxQueueSize(getLock()); }
+};
+
+//******************************************************************************
+/**
+ * the reading end of a coalescing queue
+ * When the last writer is destroyed, all pop's return with State::empty
+ */
+template<typename KEY, typename T, typename HASH = std::hash<KEY> >
+using CoalescingQueue = asynchronous::Reader< asynchronous::basic_coalescing_queue<KEY, T, HASH> >;
+
+template<typename KEY, typename T, typename HASH = std::hash<KEY> >
+using SharedCoalescingQueue = asynchronous::Writer< asynchronous::basic_coalescing_queue<KEY, T, HASH> >;
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
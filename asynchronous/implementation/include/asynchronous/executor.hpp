@@ -0,0 +1,120 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include <chrono>
+#include <functional>
+#include <future>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+/**
+ * An executor is any object that offers
+ *     executor.execute(job);
+ * where job is a callable without parameters.
+ * The executor decides where and when the job is run:
+ *  - InlineExecutor    runs it right away in the calling thread
+ *  - ThreadExecutor    starts a new (detached) thread for every job
+ *  - LazyThreadPool    runs it in one of its threads
+ *  - WorkStealingPool  runs it in one of its threads
+ *
+ * An executor that additionally offers
+ *     bool executor.runPendingJob();
+ * lets waiting threads help with the pending jobs instead of blocking,
+ * so nested waits do not dead-lock the executor.
+ */
+class InlineExecutor
+{
+public:
+    template<typename FUNC>
+    void execute(FUNC&& func) const { std::invoke(std::forward<FUNC>(func)); }
+};
+
+class ThreadExecutor
+{
+public:
+    template<typename FUNC>
+    void execute(FUNC&& func) const { std::thread(std::forward<FUNC>(func)).detach(); }
+};
+
+//------------------------------------------------------------------------------
+namespace details {
+//******************************************************************************
+
+template<typename T, typename = void>
+struct is_executor : std::false_type {};
+
+template<typename T>
+struct is_executor<T, std::void_t< decltype( std::declval<T&>().execute(std::declval< std::function<void()> >()) )> >
+        : std::true_type {};
+
+template<typename T, typename = void>
+struct has_pending_jobs : std::false_type {};
+
+template<typename T>
+struct has_pending_jobs<T, std::void_t< decltype( std::declval<T&>().runPendingJob() )> >
+        : std::true_type {};
+
+//******************************************************************************
+}  // namespace details
+
+template<typename T>
+constexpr bool is_executor_v = details::is_executor< std::decay_t<T> >::value;
+
+template<typename T>
+using enable_if_executor_t = std::enable_if_t< is_executor_v<T> >;
+
+/**
+ * wait until the future is ready.
+ * If the executor can run pending jobs, the calling thread helps
+ * with them while waiting, otherwise it simply blocks.
+ * @param executor that is supposed to set the future
+ * @param future to wait for
+ */
+template<typename EXECUTOR, typename FUTURE>
+inline void wait(EXECUTOR& executor, const FUTURE& future)
+{
+    if constexpr (details::has_pending_jobs< std::decay_t<EXECUTOR> >::value)
+    {
+        constexpr auto idle = std::chrono::microseconds{50};
+        while (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready)
+        {
+            if (not executor.runPendingJob()) { future.wait_for(idle); }
+        }
+    }
+    else
+    {
+        (void) executor;
+        future.wait();
+    }
+}
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
@@ -0,0 +1,256 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/start_threads.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+namespace details {
+//******************************************************************************
+
+/**
+ * @brief This class searches an iterator range in chunks of a fixed size
+ *        (a dynamic Partition, so the chunks are handed out in ascending order).
+ *        As soon as a match is found, no more chunks are handed out, because
+ *        all of them are behind the match. Chunks that were handed out before
+ *        are only searched up to the best match found so far, so the lowest
+ *        matching index is found deterministically.
+ * @tparam ITERATOR of the range
+ * @tparam PREDICATE callable as bool = predicate(element)
+ */
+template<typename ITERATOR, typename PREDICATE>
+class Finder
+{
+public:
+    using walker_t = PartitionWalker<ITERATOR>;
+    using range_t = typename walker_t::Range;
+
+    /**
+     * chunks per thread, the more the sooner the threads notice a match
+     */
+    static constexpr size_t chunksPerThread = 16;
+
+    /**
+     * upper limit of the chunk size, so a match stops the search soon
+     */
+    static constexpr size_t maxChunkSize = 4096;
+
+private:
+    const size_t        ivSize;
+    const bool          ivLowestIndex;
+    PREDICATE&          ivPredicate;
+    walker_t            ivWalker;
+    std::atomic_size_t  ivBest;
+    std::mutex          ivMutex;
+    std::exception_ptr  ivException;
+
+    static size_t getChunkSize(size_t size, size_t threadCount)
+    { return std::clamp<size_t>(size / (threadCount * chunksPerThread), 1, maxChunkSize); }
+
+    /**
+     * @return true if the element with this index can not be the result anymore
+     */
+    bool isBehindBest(size_t index) const
+    {
+        const auto best = ivBest.load(std::memory_order_relaxed);
+        if (ivLowestIndex) { return (index >= best); }
+        return (best != ivSize);
+    }
+
+    void setBest(size_t index)
+    {
+        auto best = ivBest.load(std::memory_order_relaxed);
+        while( (index < best) && not ivBest.compare_exchange_weak(best, index) )
+        {}
+        ivWalker.stop();
+    }
+
+    void setException(std::exception_ptr exception)
+    {
+        std::unique_lock lock{ivMutex};
+        if (not ivException) { ivException = std::move(exception); }
+    }
+
+    void searchRange(const range_t& range)
+    {
+        auto index = range.offset;
+        for(auto pos = range.first; pos != range.last; ++pos, ++index)
+        {
+            if (isBehindBest(index)) { return; }
+            if (std::invoke(ivPredicate, *pos)) { setBest(index); return; }
+        }
+    }
+
+public:
+    /**
+     * @param begin of the range
+     * @param size number of elements in the range
+     * @param threadCount number of threads that call "run"
+     * @param predicate to be called on the elements
+     * @param lowestIndex if false, any match stops the search
+     */
+    explicit Finder(ITERATOR begin, size_t size, size_t threadCount,
+                    PREDICATE& predicate, bool lowestIndex) :
+            ivSize(size),
+            ivLowestIndex(lowestIndex),
+            ivPredicate(predicate),
+            ivWalker(std::move(begin), size, threadCount, dynamic(getChunkSize(size, threadCount))),
+            ivBest(size),
+            ivMutex(),
+            ivException()
+    {}
+
+    /**
+     * the actual worker function, it is called once in every thread
+     * the first exception stops all workers and is kept for "getResult"
+     */
+    void run()
+    {
+        range_t range;
+
+        try
+        {
+            while(ivWalker.getNext(range))
+            { searchRange(range); }
+        }
+        catch(...)
+        {
+            setException(std::current_exception());
+            ivWalker.stop();
+        }
+    }
+
+    /**
+     * @return the index of the match, or the size of the range if there is none
+     */
+    size_t getResult() const
+    {
+        if (ivException) { std::rethrow_exception(ivException); }
+        return ivBest.load();
+    }
+};
+
+/**
+ * search the container in parallel
+ * @return the index of the match, or the size of the container if there is none
+ */
+template<typename CONTAINER, typename PREDICATE>
+inline size_t findIndex(size_t threadCount, CONTAINER& container, PREDICATE& predicate, bool lowestIndex)
+{
+    using ITERATOR = decltype( std::begin(container) );
+    using FINDER = Finder<ITERATOR, PREDICATE>;
+
+    const auto size = details::getSize(container);
+    if (size == 0) { return size; }
+
+    if (threadCount == 0)
+    { throw std::invalid_argument("find: zero threads can not search any element"); }
+
+    threadCount = std::min(threadCount, size);
+    FINDER finder(std::begin(container), size, threadCount, predicate, lowestIndex);
+    run_threads(threadCount, &FINDER::run, &finder);
+    return finder.getResult();
+}
+
+//******************************************************************************
+}  // namespace details
+
+/**
+ * @brief searches the container in parallel on at most threadCount threads
+ *        (incl. the calling thread) for the first element the predicate is true for.
+ *        As soon as a thread finds a match, the threads stop to take new elements,
+ *        but the result is always the first match (the one with the lowest index)
+ *        Any exception thrown by the predicate stops all threads
+ *        and is re-thrown in the calling thread.
+ *
+ * @example:
+ *     std::vector<int> numbers = { 1,2,3,4,5 };
+ *     auto pos = asynchronous::find_if(2, numbers, [](int a) { return a > 2; });
+ *     EXPECT_EQ(3, *pos);
+ *
+ * @param threadCount number of threads to use (incl. the calling thread)
+ * @param container any container supporting std::begin/end
+ * @param predicate will be called on the elements, like
+ *        bool = predicate(element);
+ *        NOTE: it is called concurrently and might be called on elements
+ *              behind the match
+ * @exception std::invalid_argument if threadCount is 0 but the container is not empty
+ * @return iterator to the first match, or std::end(container) if there is none
+ */
+template<typename CONTAINER, typename PREDICATE>
+inline auto find_if(size_t threadCount, CONTAINER&& container, PREDICATE&& predicate)
+{
+    static_assert(std::is_lvalue_reference_v<CONTAINER>,
+                  "find_if: the returned iterator would point into a temporary container");
+
+    const auto index = details::findIndex(threadCount, container, predicate, true);
+    return std::next(std::begin(container), static_cast<std::ptrdiff_t>(index));
+}
+
+/**
+ * @brief checks in parallel, if the predicate is true for any element
+ *        all threads stop as soon as any match is found
+ *        see find_if
+ * @param threadCount number of threads to use (incl. the calling thread)
+ * @param container any container supporting std::begin/end
+ * @param predicate will be called on the elements
+ * @return true if the predicate is true for at least one element
+ */
+template<typename CONTAINER, typename PREDICATE>
+inline bool any_of(size_t threadCount, CONTAINER&& container, PREDICATE&& predicate)
+{
+    return details::findIndex(threadCount, container, predicate, false)
+                != details::getSize(container);
+}
+
+/**
+ * @brief checks in parallel, if the predicate is true for all elements
+ *        all threads stop as soon as any mismatch is found
+ *        see find_if
+ * @param threadCount number of threads to use (incl. the calling thread)
+ * @param container any container supporting std::begin/end
+ * @param predicate will be called on the elements
+ * @return true if the predicate is true for all elements (or the container is empty)
+ */
+template<typename CONTAINER, typename PREDICATE>
+inline bool all_of(size_t threadCount, CONTAINER&& container, PREDICATE&& predicate)
+{
+    auto mismatch = [&predicate](auto&& element) -> bool
+                    { return not std::invoke(predicate, std::forward<decltype(element)>(element)); };
+    return not any_of(threadCount, container, mismatch);
+}
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
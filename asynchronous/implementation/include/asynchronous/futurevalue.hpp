@@ -24,16 +24,151 @@
 
 //******************************************************************************
 #include "asynchronous/doneflag.hpp"
+#include "asynchronous/executor.hpp"
+
+#include <atomic>
+#include <functional>
 #include <future>
+#include <memory>
+#include <tuple>
 
 //******************************************************************************
 namespace asynchronous {
 //******************************************************************************
 
+template<typename T>
+class ContinuableFuture;
+
+namespace details {
+//******************************************************************************
+
+/**
+ * @brief holds at most one callback, that is called exactly once
+ *        when the slot is fired, or right away if it was already fired.
+ *        Registering and firing are lock free, so firing costs
+ *        a single atomic exchange as long as nobody registered a callback.
+ */
+class ContinuationSlot
+{
+public:
+    using callback_t = std::function<void()>;
+
+private:
+    std::atomic<callback_t*> ivCallback;
+
+    static callback_t* fired()
+    {
+        static callback_t sentinel;
+        return &sentinel;
+    }
+
+    static void release(callback_t* callback)
+    {
+        if (callback != fired()) { delete callback; }
+    }
+
+public:
+    ContinuationSlot() : ivCallback(nullptr) {}
+
+    ContinuationSlot(ContinuationSlot&& other) noexcept :
+        ivCallback( other.ivCallback.exchange(nullptr) )
+    {}
+
+    ContinuationSlot& operator = (ContinuationSlot&& other) noexcept
+    {
+        release( ivCallback.exchange( other.ivCallback.exchange(nullptr) ) );
+        return *this;
+    }
+
+    ~ContinuationSlot() { release(ivCallback.load()); }
+
+    /**
+     * @param callback to be called when the slot is fired
+     * @exception std::future_error if there is already a callback
+     */
+    void set(callback_t callback)
+    {
+        std::unique_ptr<callback_t> newCallback{ new callback_t(std::move(callback)) };
+
+        callback_t* expected = nullptr;
+        if (ivCallback.compare_exchange_strong(expected, newCallback.get()))
+        {
+            newCallback.release();
+            return;
+        }
+
+        if (expected != fired())
+        { throw std::future_error(std::future_errc::future_already_retrieved); }
+
+        (*newCallback)();
+    }
+
+    /**
+     * call the callback, if there is one
+     * every further call does nothing
+     */
+    void fire()
+    {
+        std::unique_ptr<callback_t> callback{ ivCallback.exchange(fired()) };
+        if (callback.get() == fired()) { callback.release(); return; }
+        if (callback) { (*callback)(); }
+    }
+};
+
+/**
+ * @brief call callback with the future as soon as the slot is fired
+ *        NOTE: the future is moved into the callback
+ */
+template<typename T, typename CALLBACK>
+inline void onReady(ContinuationSlot& slot, std::future<T>& future, CALLBACK&& callback)
+{
+    if (not future.valid()) { throw std::future_error(std::future_errc::no_state); }
+
+    // std::function needs a copy-able callable, so the future is shared
+    auto shared = std::make_shared< std::future<T> >( std::move(future) );
+    slot.set( [shared, callback = std::forward<CALLBACK>(callback)] () mutable
+              { callback( std::move(*shared) ); } );
+}
+
+/**
+ * @brief hand func(future) over to the executor as soon as the slot is fired
+ * @return future to the result of func, that accepts further continuations
+ */
+template<typename T, typename EXECUTOR, typename FUNC,
+         typename RESULT = std::invoke_result_t< std::decay_t<FUNC>, std::future<T> > >
+inline ContinuableFuture<RESULT> then(ContinuationSlot& slot, std::future<T>& future,
+                                      EXECUTOR&& executor, FUNC&& func)
+{
+    using task_t = std::packaged_task< RESULT(std::future<T>) >;
+
+    auto task = std::make_shared<task_t>( std::forward<FUNC>(func) );
+    auto next = std::make_shared<ContinuationSlot>();
+    ContinuableFuture<RESULT> result{ task->get_future(), next };
+
+    // keeps a reference to an lvalue executor, and a copy of an rvalue executor
+    std::tuple<EXECUTOR> exec{ std::forward<EXECUTOR>(executor) };
+
+    onReady(slot, future, [task, next, exec] (std::future<T> ready) mutable
+    {
+        auto shared = std::make_shared< std::future<T> >( std::move(ready) );
+        std::get<0>(exec).execute( [task, next, shared] ()
+        {
+            (*task)( std::move(*shared) );
+            next->fire();
+        });
+    });
+
+    return result;
+}
+
+//******************************************************************************
+}  // namespace details
+
 /**
  * This class combines a promise and the connected future into one object
  * to ensure the life time of both.
  * It implements the promise API directly and the future API via operator ->
+ * Instead of waiting for the value, a continuation can be attached with "then".
  */
 template<typename T, typename PROMISE = typename std::promise<T> >
 class FutureValue
@@ -46,11 +181,13 @@ public:
 private:
     Promise_t   ivPromise;
     Future_t    ivFuture;
+    details::ContinuationSlot ivContinuation;
 
 public:
     FutureValue() :
         ivPromise(),
-        ivFuture(ivPromise.get_future())
+        ivFuture(ivPromise.get_future()),
+        ivContinuation()
     {}
 
     /**
@@ -63,7 +200,10 @@ public:
      */
     template<typename... Args>
     void set_value(Args&&... args)
-    { ivPromise.set_value(std::forward<Args>(args)...); }
+    {
+        ivPromise.set_value(std::forward<Args>(args)...);
+        ivContinuation.fire();
+    }
 
     template<typename EXCEPTION>
     void set_exception(EXCEPTION&& exc)
@@ -73,7 +213,87 @@ public:
         { ivPromise.set_exception(std::forward<EXCEPTION>(exc)); }
         else
         { ivPromise.set_exception(std::make_exception_ptr(std::forward<EXCEPTION>(exc))); }
+        ivContinuation.fire();
     }
+
+    /**
+     * hand func over to the executor as soon as the value (or exception) is set
+     * NOTE: the future is moved into func, so "get" can not be called anymore
+     *       and only one continuation can be attached
+     * @param executor any executor (see executor.hpp)
+     * @param func will be called as func(std::future<T>)
+     * @exception std::future_error if the future was already retrieved
+     * @return future to the result of func
+     */
+    template<typename EXECUTOR, typename FUNC, typename = enable_if_executor_t<EXECUTOR> >
+    auto then(EXECUTOR&& executor, FUNC&& func)
+    { return details::then(ivContinuation, ivFuture, std::forward<EXECUTOR>(executor), std::forward<FUNC>(func)); }
+
+    /**
+     * same as above, func is called by the thread setting the value
+     */
+    template<typename FUNC>
+    auto then(FUNC&& func)
+    { return then(InlineExecutor{}, std::forward<FUNC>(func)); }
+
+    /**
+     * call callback(std::future<T>) in the thread setting the value
+     * NOTE: the future is moved into callback
+     */
+    template<typename CALLBACK>
+    void onReady(CALLBACK&& callback)
+    { details::onReady(ivContinuation, ivFuture, std::forward<CALLBACK>(callback)); }
+};
+
+/**
+ * @brief the future returned by "then"
+ *        It provides the future API via operator ->
+ *        and accepts further continuations.
+ */
+template<typename T>
+class ContinuableFuture
+{
+public:
+    using Result_t  = T;
+    using Future_t  = std::future<Result_t>;
+    using Slot_t    = std::shared_ptr<details::ContinuationSlot>;
+
+private:
+    Future_t    ivFuture;
+    Slot_t      ivContinuation;
+
+public:
+    /**
+     * @param future to the result
+     * @param continuation is fired by whoever sets the result
+     */
+    explicit ContinuableFuture(Future_t future, Slot_t continuation) :
+        ivFuture(std::move(future)),
+        ivContinuation(std::move(continuation))
+    {}
+
+    /**
+     * provides the full future API through a "smart-pointer" operator
+     */
+    Future_t* operator ->() { return &ivFuture; }
+
+    /**
+     * see FutureValue::then
+     */
+    template<typename EXECUTOR, typename FUNC, typename = enable_if_executor_t<EXECUTOR> >
+    auto then(EXECUTOR&& executor, FUNC&& func)
+    { return details::then(*ivContinuation, ivFuture, std::forward<EXECUTOR>(executor), std::forward<FUNC>(func)); }
+
+    template<typename FUNC>
+    auto then(FUNC&& func)
+    { return then(InlineExecutor{}, std::forward<FUNC>(func)); }
+
+    /**
+     * see FutureValue::onReady
+     */
+    template<typename CALLBACK>
+    void onReady(CALLBACK&& callback)
+    { details::onReady(*ivContinuation, ivFuture, std::forward<CALLBACK>(callback)); }
 };
 
 //------------------------------------------------------------------------------
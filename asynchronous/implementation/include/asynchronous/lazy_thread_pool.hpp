@@ -131,6 +131,15 @@ public:
     template<typename FUNC, typename... ARGS>
     bool addJob(FUNC&& func, ARGS&&... args)
     { return addJob( Job(std::bind(std::forward<FUNC>(func), std::forward<ARGS>(args)...))); }
+
+    /**
+     * lets this pool be used as an executor (see executor.hpp)
+     * NOTE: the job has to be copy-able, because it is stored in a std::function
+     * @param job callable without parameters
+     */
+    template<typename FUNC>
+    void execute(FUNC&& job)
+    { addJob( Job(std::forward<FUNC>(job)) ); }
 };
 
 //******************************************************************************
@@ -0,0 +1,242 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/lightweight/futex.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+
+//******************************************************************************
+namespace asynchronous { namespace lightweight {
+//******************************************************************************
+/**
+ * the same as asynchronous::barrier, but without mutex and condition variable:
+ * the arriving threads decrement the counter lock-free and block on the
+ * generation word. The last one runs the reset function, resets the counter
+ * and starts the next generation (waking the waiters with one syscall).
+ * The counter and the phase it belongs to are one atomic word, so a thread
+ * arriving while the last one resets, knows which phase it arrived in,
+ * even if the reset function raises the thread count.
+ * NOTE: this barrier is neither copyable nor movable
+ */
+class barrier
+{
+public:
+    using value_t = size_t;
+    using reset_func_t = std::function<value_t(const value_t&)>;
+    using clock_t = std::chrono::steady_clock;
+    using duration_t = clock_t::duration;
+    using timepoint_t = clock_t::time_point;
+
+private:
+    using phase_t = FutexWord::value_t;
+    using state_t = std::uint64_t;      // the phase in the upper, the count in the lower half
+
+    static constexpr state_t countMask = 0xFFFFFFFF;
+    static constexpr state_t resetting = countMask;     // the count while the last one resets
+    static constexpr value_t maxCount = countMask - 1;
+
+    std::atomic<state_t>    ivState;
+    std::atomic<value_t>    ivResetCount;
+    reset_func_t            ivResetFunc;
+    FutexWord               ivGeneration;   // the number of finished phases
+
+    static phase_t phaseOf(state_t state) { return static_cast<phase_t>(state >> 32); }
+
+    static void checkCount(value_t count)
+    {
+        if (count == 0) throw std::invalid_argument("Barrier created with a thread count of 0");
+        if (count > maxCount) throw std::invalid_argument("Barrier created with a thread count too large");
+    }
+
+    /**
+     * block until the generation changes or a timeout occurs
+     * @param generation the value to wait for a change of
+     * @param timepoint when the timeout should occur (nullptr for none)
+     * @return false if a timeout occurred
+     */
+    bool waitForGeneration(phase_t generation, const timepoint_t* timepoint)
+    {
+        if (timepoint) { return ivGeneration.wait_until(generation, *timepoint); }
+        ivGeneration.wait(generation);
+        return true;
+    }
+
+    /**
+     * decrement the counter of the current phase,
+     * throws a std::logic_error if it is zero already
+     * @param phase set to the phase the caller arrived in
+     * @param last set to true if the caller was the last one of the phase
+     * @param timepoint when the timeout should occur (nullptr for none)
+     * @return false if a timeout occurred while the last one of the previous phase
+     *         was resetting (the caller did not arrive then)
+     */
+    bool arrive(phase_t& phase, bool& last, const timepoint_t* timepoint)
+    {
+        auto state = ivState.load(std::memory_order_acquire);
+        while (true)
+        {
+            const auto count = state & countMask;
+            if (count == 0) { throw std::logic_error("Waiter: value already zero"); }
+
+            if (count == resetting)
+            {
+                // wait for the next phase
+                if (not waitForGeneration(phaseOf(state), timepoint)) { return false; }
+                state = ivState.load(std::memory_order_acquire);
+                continue;
+            }
+
+            last = (count == 1);
+            const auto next = last ? (state | resetting) : (state - 1);
+            if (ivState.compare_exchange_weak(state, next, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                phase = phaseOf(state);
+                return true;
+            }
+        }
+    }
+
+    /**
+     * publish the counter with the next phase at once,
+     * and after that release the waiters of this phase
+     */
+    void startNextPhase(phase_t phase, value_t count)
+    {
+        const phase_t next = phase + 1;
+        ivState.store( (state_t{next} << 32) | count, std::memory_order_release );
+
+        ivGeneration.store(next);
+        ivGeneration.notify_all();
+    }
+
+    /**
+     * called by the last arriving thread of a phase
+     * if the reset function throws (or returns an invalid count),
+     * the next phase starts with the last count and the exception is rethrown,
+     * so the barrier stays usable
+     */
+    void reset(phase_t phase)
+    {
+        const auto count = ivResetCount.load(std::memory_order_relaxed);
+        value_t resetCount = count;
+        try
+        {
+            resetCount = ivResetFunc(count);
+            checkCount(resetCount);
+        }
+        catch(...)
+        {
+            startNextPhase(phase, count);
+            throw;
+        }
+
+        ivResetCount.store(resetCount);
+        startNextPhase(phase, resetCount);
+    }
+
+    /**
+     * @return true if the phase is finished (the generation is past it)
+     */
+    static bool isFinished(phase_t generation, phase_t phase)
+    { return static_cast<std::int32_t>(generation - phase) > 0; }
+
+    /**
+     * arrive and wait for the end of the phase
+     * @param timepoint when the timeout should occur (nullptr for none)
+     * @return false if a timeout occurred
+     */
+    bool countDownAndWait(const timepoint_t* timepoint)
+    {
+        phase_t phase = 0;
+        bool last = false;
+        if (not arrive(phase, last, timepoint)) { return false; }
+        if (last)
+        {
+            reset(phase);
+            return true;
+        }
+
+        while (true)
+        {
+            auto generation = ivGeneration.load();
+            if (isFinished(generation, phase)) { return true; }
+            if (not waitForGeneration(generation, timepoint))
+            { return isFinished(ivGeneration.load(), phase); }
+        }
+    }
+
+public:
+    /**
+      * create a barrier
+      * The value is the initial value of the barrier
+      * Throws an std::invalid_argument if the value is 0
+     * @param Value
+     * @param Func called with the last thread count, returns the next one
+     */
+    explicit barrier(value_t Value, reset_func_t Func) :
+        ivState{Value},
+        ivResetCount{Value},
+        ivResetFunc(std::move(Func)),
+        ivGeneration{0}
+    {
+        checkCount(Value);
+    }
+
+    explicit barrier(value_t Value) : barrier(Value, [](const value_t& count) { return count;})
+    { }
+
+    //--------------------------------------------------------------------------
+    /**
+     * @brief Decrements the internal thread count by 1.
+     *        If the resulting count is not 0, blocks the calling thread
+     *        until the internal count is decremented to 0
+     *        by one or more other threads calling count_down_and_wait().
+     *        or a timeout occurred
+     * @param timepoint when the timeout should occur
+     * @return false if a timeout occurred (if it occurred while the last thread
+     *         of the previous phase was still resetting, the count is not decremented)
+     */
+    bool count_down_and_wait_until(const timepoint_t& timepoint)
+    { return countDownAndWait(&timepoint); }
+
+    bool count_down_and_wait_for(const duration_t& duration)
+    { return count_down_and_wait_until(clock_t::now() + duration); }
+
+    void count_down_and_wait()
+    { countDownAndWait(nullptr); }
+
+    /**
+     * @return the current reset thread count
+     */
+    value_t getResetCount() const { return ivResetCount.load(); }
+};
+
+//******************************************************************************
+}}  // namespace asynchronous::lightweight
+//******************************************************************************
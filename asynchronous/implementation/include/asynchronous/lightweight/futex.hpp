@@ -0,0 +1,118 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+//******************************************************************************
+namespace asynchronous { namespace lightweight {
+//******************************************************************************
+
+/**
+ * a 32bit word, threads can block on until its value changes
+ * On Linux this is a futex, so waiting and waking is one syscall
+ * and there is no mutex or condition variable involved at all.
+ * The number of sleepers is counted, so notify_all does not
+ * enter the kernel if nobody is waiting.
+ */
+class FutexWord
+{
+public:
+    using value_t = std::uint32_t;
+    using clock_t = std::chrono::steady_clock;
+    using duration_t = clock_t::duration;
+    using timepoint_t = clock_t::time_point;
+
+private:
+    std::atomic<value_t>  ivValue;
+    std::atomic<value_t>  ivSleepers;
+
+    /**
+     * block as long as the word has this value
+     * or the timeout (relative, if not null) has passed
+     * spurious wake ups are possible
+     */
+    void sleep(value_t expected, const duration_t* timeout);
+    void wake();
+
+public:
+    explicit FutexWord(value_t value = 0) :
+        ivValue{value},
+        ivSleepers{0}
+    {}
+
+    FutexWord(const FutexWord&) = delete;
+    FutexWord& operator = (const FutexWord&) = delete;
+
+    value_t load(std::memory_order order = std::memory_order_seq_cst) const
+    { return ivValue.load(order); }
+
+    void store(value_t value)
+    { ivValue.store(value); }
+
+    value_t exchange(value_t value)
+    { return ivValue.exchange(value); }
+
+    value_t fetch_add(value_t value)
+    { return ivValue.fetch_add(value); }
+
+    value_t fetch_sub(value_t value)
+    { return ivValue.fetch_sub(value); }
+
+    value_t fetch_or(value_t value)
+    { return ivValue.fetch_or(value); }
+
+    bool compare_exchange_weak(value_t& expected, value_t desired)
+    { return ivValue.compare_exchange_weak(expected, desired); }
+
+    /**
+     * wake up all threads blocked in wait*
+     * call it after the value was modified
+     */
+    void notify_all()
+    {
+        if (ivSleepers.load() > 0) { wake(); }
+    }
+
+    /**
+     * blocks the calling thread as long as the value equals "old"
+     * or the timeout occurred
+     * @param old the value to wait for a change of
+     * @param timepoint when the timeout should occur
+     * @return false if a timeout occurred
+     */
+    bool wait_until(value_t old, const timepoint_t& timepoint);
+
+    /**
+     * blocks the calling thread as long as the value equals "old"
+     * @param old the value to wait for a change of
+     */
+    void wait(value_t old);
+};
+
+//******************************************************************************
+}}  // namespace asynchronous::lightweight
+//******************************************************************************
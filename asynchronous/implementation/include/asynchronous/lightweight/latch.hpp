@@ -0,0 +1,146 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/lightweight/futex.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+
+//******************************************************************************
+namespace asynchronous { namespace lightweight {
+//******************************************************************************
+
+namespace details {
+//******************************************************************************
+/**
+ * lock-free decrement of the counter, that must not go below zero
+ * @param counter
+ * @param what message of the logic_error thrown if the counter is zero already
+ * @return the value before the decrement
+ */
+inline size_t decrementNonZero(std::atomic<size_t>& counter, const char* what)
+{
+    auto current = counter.load(std::memory_order_relaxed);
+    do
+    {
+        if (current == 0) { throw std::logic_error(what); }
+    } while (not counter.compare_exchange_weak(current, current - 1,
+                                               std::memory_order_acq_rel,
+                                               std::memory_order_relaxed));
+    return current;
+}
+
+//******************************************************************************
+}  // namespace details
+
+/**
+ * the same as asynchronous::latch, but without mutex and condition variable:
+ * count_down is a lock-free decrement and only the last one
+ * wakes up the waiters (with a syscall only if there are any).
+ * NOTE: this latch is neither copyable nor movable
+ */
+class latch
+{
+public:
+    using value_t = size_t;
+    using clock_t = std::chrono::steady_clock;
+    using duration_t = clock_t::duration;
+    using timepoint_t = clock_t::time_point;
+
+private:
+    std::atomic<value_t>    ivCount;
+    FutexWord               ivReleased;     // becomes 1 when ivCount reaches zero
+
+    bool release()
+    {
+        ivReleased.store(1);
+        ivReleased.notify_all();
+        return true;
+    }
+
+public:
+    explicit latch(value_t value) :
+        ivCount{value},
+        ivReleased{ (value == 0) ? 1u : 0u }
+    {}
+
+    /**
+     * decrement the counter, throws a std::logic_error if it is zero already
+     * @return true if this call brought the counter to zero
+     */
+    bool count_down()
+    {
+        if (details::decrementNonZero(ivCount, "latch: value already zero") == 1)
+        { return release(); }
+        return false;
+    }
+
+    /**
+     * @return true if the counter reached zero
+     */
+    bool try_wait() const { return ivReleased.load() != 0; }
+
+    /**
+     * blocks the calling thread until the counter reaches zero
+     */
+    void wait() { ivReleased.wait(0); }
+
+    /**
+     * blocks the calling thread until the counter reaches zero
+     * or a timeout occurred
+     * @param timepoint when the timeout should occur
+     * @return false if a timeout occurred
+     */
+    bool wait_until(const timepoint_t& timepoint)
+    { return ivReleased.wait_until(0, timepoint); }
+
+    bool wait_for(const duration_t& duration)
+    { return wait_until(clock_t::now() + duration); }
+
+    bool count_down_and_wait_until(const timepoint_t& timepoint)
+    {
+        if (count_down()) { return true; }
+        return wait_until(timepoint);
+    }
+
+    bool count_down_and_wait_for(const duration_t& duration)
+    { return count_down_and_wait_until(clock_t::now() + duration); }
+
+    void count_down_and_wait()
+    {
+        if (not count_down()) { wait(); }
+    }
+
+    /**
+     * @return the current counter
+     */
+    value_t getValue() const { return ivCount.load(); }
+};
+
+//******************************************************************************
+}}  // namespace asynchronous::lightweight
+//******************************************************************************
@@ -0,0 +1,69 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/lightweight/futex.hpp"
+
+#include <chrono>
+
+//******************************************************************************
+namespace asynchronous { namespace lightweight {
+//******************************************************************************
+/**
+ * the same as asynchronous::OneTimeSignal, but it is only one 32bit word
+ * (plus the sleeper count), instead of a promise/future shared state.
+ * NOTE: this signal is neither copyable nor movable
+ */
+class OneTimeSignal
+{
+private:
+    FutexWord ivState;
+
+public:
+    OneTimeSignal() :
+        ivState{0}
+    {}
+
+    /**
+     * sleep at least for the given duration
+     * @param duration
+     * @return true on timeout
+     */
+    template<typename Duration>
+    bool wait_for(const Duration& duration)
+    {
+        auto timeout = std::chrono::duration_cast<FutexWord::duration_t>(duration);
+        return not ivState.wait_until(0, FutexWord::clock_t::now() + timeout);
+    }
+
+    void notify()
+    {
+        if (ivState.exchange(1) == 0)
+        { ivState.notify_all(); }
+    }
+};
+
+//******************************************************************************
+}}  // namespace asynchronous::lightweight
+//******************************************************************************
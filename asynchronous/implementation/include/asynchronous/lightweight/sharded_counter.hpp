@@ -0,0 +1,251 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/lightweight/futex.hpp"
+#include "asynchronous/traits/cacheline.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+//******************************************************************************
+namespace asynchronous { namespace lightweight {
+//******************************************************************************
+
+namespace details {
+//******************************************************************************
+/**
+ * @return a number unique to the calling thread, handed out round robin
+ */
+inline size_t threadShardIndex()
+{
+    static std::atomic<size_t> next{0};
+    static thread_local const size_t index = next.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+//******************************************************************************
+}  // namespace details
+
+/**
+ * a counter for many incrementing threads, like a progress counter:
+ * every thread increments its own cache line (shard),
+ * and only reading the value sums up all shards.
+ * Like WaiterForAtLeast, one can wait until the counter reaches a target.
+ * A waiter arms every shard with a limit, chosen so that reaching the target
+ * has to cross at least one of them (the remaining distance split evenly),
+ * and an increment only wakes the waiters, if it crosses the limit of its shard.
+ * So a waiter costs a few wake-ups per halving of its distance to the target,
+ * instead of one per increment.
+ * NOTE: the counter only grows, so a reached target stays reached
+ * NOTE: this counter is neither copyable nor movable
+ */
+class ShardedCounter
+{
+public:
+    using value_t = size_t;
+    using clock_t = std::chrono::steady_clock;
+    using duration_t = clock_t::duration;
+    using timepoint_t = clock_t::time_point;
+
+private:
+    static constexpr value_t disarmed = std::numeric_limits<value_t>::max();
+
+    struct Shard
+    {
+        std::atomic<value_t> value;
+        std::atomic<value_t> wakeAt;    // the limit set by the waiters
+    };
+    using shard_t = traits::CacheLinePadded<Shard>;
+
+    size_t                      ivMask;     // number of shards - 1
+    std::unique_ptr<shard_t[]>  ivShards;
+    FutexWord                   ivGeneration;   // bumped when a limit was crossed
+
+    static size_t shardCount(size_t shards)
+    {
+        if (shards == 0) { shards = std::max<size_t>(std::thread::hardware_concurrency(), 1); }
+        size_t count = 1;
+        while (count < shards) { count <<= 1; }
+        return count;
+    }
+
+    static void lower(std::atomic<value_t>& limit, value_t value)
+    {
+        auto current = limit.load();
+        while ( (value < current) && (not limit.compare_exchange_weak(current, value)) )
+        { /* retry */ }
+    }
+
+    void wakeWaiters()
+    {
+        ivGeneration.fetch_add(1);
+        ivGeneration.notify_all();
+    }
+
+    /**
+     * @param target the value to reach
+     * @param wait called as wait(generation), blocks until the generation changed,
+     *        returns false if a timeout occurred
+     * @return true if the target was reached
+     */
+    template<typename WAIT>
+    bool waitFor(value_t target, WAIT&& wait)
+    {
+        const auto count = getShardCount();
+        std::vector<value_t> limits(count);
+        while (true)
+        {
+            value_t sum = 0;
+            for(size_t i = 0; i < count; ++i)
+            {
+                limits[i] = ivShards[i].value.value.load();
+                sum += limits[i];
+            }
+            if (sum >= target) { return true; }
+
+            // at least one shard has to grow by step, to reach the target
+            const auto step = (target - sum + count - 1) / count;
+            for(size_t i = 0; i < count; ++i)
+            {
+                limits[i] += step;
+                lower(ivShards[i].value.wakeAt, limits[i]);
+            }
+
+            // a shard that crossed (or was disarmed) meanwhile might not wake us up
+            const auto generation = ivGeneration.load();
+            bool armed = true;
+            for(size_t i = 0; armed && (i < count); ++i)
+            {
+                const auto& shard = ivShards[i].value;
+                armed = (shard.value.load() < limits[i]) && (shard.wakeAt.load() <= limits[i]);
+            }
+            if (not armed) { continue; }
+
+            if (not wait(generation)) { return (getValue() >= target); }
+        }
+    }
+
+public:
+    /**
+     * @param value the initial value
+     * @param shards the number of shards (0 = one per core),
+     *               rounded up to a power of two
+     */
+    explicit ShardedCounter(value_t value = 0, size_t shards = 0) :
+        ivMask(shardCount(shards) - 1),
+        ivShards(new shard_t[ivMask + 1]),
+        ivGeneration()
+    {
+        for(size_t i = 0; i <= ivMask; ++i)
+        {
+            ivShards[i].value.value.store(0, std::memory_order_relaxed);
+            ivShards[i].value.wakeAt.store(disarmed, std::memory_order_relaxed);
+        }
+        ivShards[0].value.value.store(value);
+    }
+
+    ShardedCounter(const ShardedCounter&) = delete;
+    ShardedCounter& operator = (const ShardedCounter&) = delete;
+
+    /**
+     * @return the number of shards
+     */
+    size_t getShardCount() const { return ivMask + 1; }
+
+    /**
+     * @return how often the waiters were woken up
+     */
+    size_t getWakeUpCount() const { return ivGeneration.load(); }
+
+    /**
+     * add to the shard of the calling thread
+     * NOTE: the increment is no stronger than a relaxed one on x86
+     *       (a locked add either way), but its order to the load of the limit
+     *       guarantees, that a waiter sees it or gets woken up.
+     *       The limit is in the same cache line as the shard.
+     * @param value what to add
+     */
+    void add(value_t value)
+    {
+        auto& shard = ivShards[details::threadShardIndex() & ivMask].value;
+        const auto now = shard.value.fetch_add(value, std::memory_order_seq_cst) + value;
+        if (now < shard.wakeAt.load(std::memory_order_seq_cst)) { return; }
+
+        // only the one that disarms the limit wakes up the waiters
+        if (shard.wakeAt.exchange(disarmed) != disarmed) { wakeWaiters(); }
+    }
+
+    ShardedCounter& operator += (value_t value) { add(value); return *this; }
+    ShardedCounter& operator ++ () { add(1); return *this; }
+
+    /**
+     * @return the sum of all shards
+     */
+    value_t getValue() const
+    {
+        value_t sum = 0;
+        for(size_t i = 0; i <= ivMask; ++i) { sum += ivShards[i].value.value.load(std::memory_order_seq_cst); }
+        return sum;
+    }
+
+    /**
+     * blocks the calling thread until the counter reaches the target
+     * or a timeout occurred
+     * @param timepoint when the timeout should occur
+     * @param target the value to reach
+     * @return true if the target was reached
+     */
+    bool wait_until(const timepoint_t& timepoint, value_t target)
+    {
+        return waitFor(target, [this, &timepoint](FutexWord::value_t generation)
+                               { return ivGeneration.wait_until(generation, timepoint); });
+    }
+
+    bool wait_for(const duration_t& duration, value_t target)
+    { return wait_until(clock_t::now() + duration, target); }
+
+    /**
+     * blocks the calling thread until the counter reaches the target
+     * @param target the value to reach
+     */
+    void wait(value_t target)
+    {
+        waitFor(target, [this](FutexWord::value_t generation)
+                        {
+                            ivGeneration.wait(generation);
+                            return true;
+                        });
+    }
+};
+
+//******************************************************************************
+}}  // namespace asynchronous::lightweight
+//******************************************************************************
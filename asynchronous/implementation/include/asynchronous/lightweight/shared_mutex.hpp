@@ -0,0 +1,132 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/lightweight/futex.hpp"
+
+#include <mutex>
+
+//******************************************************************************
+namespace asynchronous { namespace lightweight {
+//******************************************************************************
+/**
+ * a reader/writer mutex (SharedMutex requirements) that prefers the writers:
+ * as soon as a writer is waiting, no new reader gets the lock,
+ * so a steady stream of readers can not starve the writers.
+ * The readers only do one compare-exchange on the state word,
+ * the writers are serialized by a plain mutex first.
+ * NOTE: this mutex is neither copyable nor movable
+ */
+class WriterPreferringMutex
+{
+private:
+    using value_t = FutexWord::value_t;
+
+    static constexpr value_t writer  = value_t{1} << 31;   //!< a writer owns the lock
+    static constexpr value_t waiting = value_t{1} << 30;   //!< a writer waits for the readers
+    static constexpr value_t readers = waiting - 1;        //!< the number of readers
+
+    std::mutex  ivWriterMutex;
+    FutexWord   ivState;
+
+public:
+    WriterPreferringMutex() :
+        ivWriterMutex(),
+        ivState{0}
+    {}
+
+    //--------------------------------------------------------------------------
+    void lock()
+    {
+        ivWriterMutex.lock();
+
+        // stop new readers and wait for the current ones to leave
+        auto state = ivState.fetch_or(waiting) | waiting;
+        while (true)
+        {
+            if ((state & readers) == 0)
+            {
+                if (ivState.compare_exchange_weak(state, writer)) { return; }
+                continue;
+            }
+            ivState.wait(state);
+            state = ivState.load();
+        }
+    }
+
+    bool try_lock()
+    {
+        if (not ivWriterMutex.try_lock()) { return false; }
+
+        value_t state = 0;
+        if (ivState.compare_exchange_weak(state, writer)) { return true; }
+
+        ivWriterMutex.unlock();
+        return false;
+    }
+
+    void unlock()
+    {
+        ivState.store(0);
+        ivState.notify_all();
+        ivWriterMutex.unlock();
+    }
+
+    //--------------------------------------------------------------------------
+    void lock_shared()
+    {
+        auto state = ivState.load();
+        while (true)
+        {
+            if ((state & (writer | waiting)) == 0)
+            {
+                if (ivState.compare_exchange_weak(state, state + 1)) { return; }
+                continue;
+            }
+            ivState.wait(state);
+            state = ivState.load();
+        }
+    }
+
+    bool try_lock_shared()
+    {
+        auto state = ivState.load();
+        while ((state & (writer | waiting)) == 0)
+        {
+            if (ivState.compare_exchange_weak(state, state + 1)) { return true; }
+        }
+        return false;
+    }
+
+    void unlock_shared()
+    {
+        auto state = ivState.fetch_sub(1) - 1;
+        if ( ((state & readers) == 0) && ((state & waiting) != 0) )
+        { ivState.notify_all(); }
+    }
+};
+
+//******************************************************************************
+}}  // namespace asynchronous::lightweight
+//******************************************************************************
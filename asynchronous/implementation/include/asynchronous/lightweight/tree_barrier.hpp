@@ -0,0 +1,240 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/lightweight/futex.hpp"
+#include "asynchronous/traits/cacheline.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+//******************************************************************************
+namespace asynchronous { namespace lightweight {
+//******************************************************************************
+/**
+ * a combining tree barrier with sense reversal for high thread counts:
+ * the participants arrive in groups of "fanIn" at the leaves of a tree,
+ * only the last one of every group climbs up to the parent node,
+ * and the last one at the root completes the phase by flipping the sense word.
+ * So every counter is touched by at most fanIn threads,
+ * instead of every thread serializing on one mutex.
+ * The waiters spin a little on the sense word before they block on it (futex).
+ *
+ * The reset function is called by the last arriving thread
+ * and may change the number of participants for the next phase.
+ * NOTE: a participant can not leave a phase, so there are no timed waits
+ * NOTE: this barrier is neither copyable nor movable
+ */
+class tree_barrier
+{
+public:
+    using value_t = size_t;
+    using reset_func_t = std::function<value_t(const value_t&)>;
+
+    static constexpr size_t defaultFanIn = 4;
+    static constexpr size_t spinCount = 2048;
+
+private:
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    struct alignas(traits::cacheLineSize) Node
+    {
+        std::atomic<size_t> count{0};
+        size_t expected = 0;
+        size_t parent = npos;
+    };
+
+    size_t                      ivFanIn;
+    size_t                      ivSpinCount;    // spinning is useless on one core
+    std::atomic<value_t>        ivResetCount;
+    reset_func_t                ivResetFunc;
+    std::unique_ptr<Node[]>     ivNodes;
+
+    alignas(traits::cacheLineSize) std::atomic<size_t> ivTicket;
+    alignas(traits::cacheLineSize) FutexWord ivSense;
+
+    /**
+     * (re)build the tree for this number of participants
+     * NOTE: only called while nobody is inside the tree
+     * @param participants
+     */
+    void build(size_t participants)
+    {
+        std::vector<size_t> expected;
+        std::vector<size_t> parent;
+
+        size_t levelBegin = 0;
+        size_t children = participants;
+        while (true)
+        {
+            const size_t nextBegin = expected.size();
+            const size_t nodes = (children + ivFanIn - 1) / ivFanIn;
+            for (size_t n = 0; n < nodes; ++n)
+            {
+                expected.push_back(std::min(ivFanIn, children - n * ivFanIn));
+                parent.push_back(npos);
+            }
+
+            if (nextBegin > 0)  // link the previous level to this one
+            {
+                for (size_t c = 0; c < children; ++c)
+                { parent[levelBegin + c] = nextBegin + c / ivFanIn; }
+            }
+
+            if (nodes <= 1) { break; }
+            levelBegin = nextBegin;
+            children = nodes;
+        }
+
+        ivNodes.reset(new Node[expected.size()]);
+        for (size_t n = 0; n < expected.size(); ++n)
+        {
+            ivNodes[n].count.store(expected[n], std::memory_order_relaxed);
+            ivNodes[n].expected = expected[n];
+            ivNodes[n].parent = parent[n];
+        }
+    }
+
+    /**
+     * count down the node, and if it was the last one, its parent
+     * @param node index of the leaf
+     * @return true if the root was reached (the phase is complete)
+     */
+    bool arrive(size_t node)
+    {
+        while (true)
+        {
+            Node& current = ivNodes[node];
+            if (current.count.fetch_sub(1, std::memory_order_acq_rel) != 1) { return false; }
+
+            // nobody else touches this node until the phase is complete
+            current.count.store(current.expected, std::memory_order_relaxed);
+            if (current.parent == npos) { return true; }
+            node = current.parent;
+        }
+    }
+
+    /**
+     * called by the last arriving thread: reset and release the waiters
+     * @param sense the sense of the phase that is completed
+     */
+    void complete(FutexWord::value_t sense)
+    {
+        const auto count = ivResetCount.load(std::memory_order_relaxed);
+        const auto resetCount = ivResetFunc(count);
+        if (resetCount != count)
+        {
+            build(resetCount);
+            ivResetCount.store(resetCount);
+        }
+        ivTicket.store(0, std::memory_order_relaxed);
+
+        ivSense.store(1 - sense);
+        ivSense.notify_all();
+    }
+
+    /**
+     * wait for the sense to flip
+     * @param sense the sense of the phase we arrived in
+     */
+    void waitForRelease(FutexWord::value_t sense)
+    {
+        for (size_t i = 0; i < ivSpinCount; ++i)
+        {
+            if (ivSense.load(std::memory_order_acquire) != sense) { return; }
+        }
+        ivSense.wait(sense);
+    }
+
+public:
+    /**
+     * create a tree barrier
+     * Throws an std::invalid_argument if the value is 0 or the fanIn is less than 2
+     * @param Value the number of participants
+     * @param Func called with the last thread count, returns the next one
+     * @param fanIn the number of arrivals per tree node (at least 2)
+     */
+    explicit tree_barrier(value_t Value, reset_func_t Func, size_t fanIn = defaultFanIn) :
+        ivFanIn(fanIn),
+        ivSpinCount( (std::thread::hardware_concurrency() > 1) ? spinCount : 0 ),
+        ivResetCount{Value},
+        ivResetFunc(std::move(Func)),
+        ivNodes(),
+        ivTicket{0},
+        ivSense{0}
+    {
+        if (Value == 0) throw std::invalid_argument("Barrier created with a thread count of 0");
+        if (fanIn < 2) throw std::invalid_argument("Barrier created with a fanIn less than 2");
+        build(Value);
+    }
+
+    explicit tree_barrier(value_t Value) :
+        tree_barrier(Value, [](const value_t& count) { return count;})
+    { }
+
+    //--------------------------------------------------------------------------
+    /**
+     * @brief arrive as this participant and block the calling thread
+     *        until all other participants have arrived as well.
+     *        Every participant index in [0, getResetCount()) has to arrive
+     *        exactly once per phase. This is the fastest path, as the
+     *        participants do not share any counter at the leaves.
+     * @param participant index of the calling participant
+     */
+    void count_down_and_wait(size_t participant)
+    {
+        if (participant >= ivResetCount.load(std::memory_order_relaxed))
+        { throw std::logic_error("tree_barrier: participant out of range"); }
+
+        const auto sense = ivSense.load(std::memory_order_acquire);
+        if (arrive(participant / ivFanIn))
+        {
+            complete(sense);
+            return;
+        }
+        waitForRelease(sense);
+    }
+
+    /**
+     * @brief same as asynchronous::barrier::count_down_and_wait:
+     *        the participant index is taken from a shared ticket counter
+     */
+    void count_down_and_wait()
+    { count_down_and_wait(ivTicket.fetch_add(1, std::memory_order_relaxed)); }
+
+    /**
+     * @return the current reset thread count
+     */
+    value_t getResetCount() const { return ivResetCount.load(); }
+};
+
+//******************************************************************************
+}}  // namespace asynchronous::lightweight
+//******************************************************************************
@@ -0,0 +1,345 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//******************************************************************************
+#if defined(__GNUC__) || defined(__clang__)
+#define ASYNCHRONOUS_CALLER_FILE() __builtin_FILE()
+#define ASYNCHRONOUS_CALLER_LINE() __builtin_LINE()
+#else
+#define ASYNCHRONOUS_CALLER_FILE() nullptr
+#define ASYNCHRONOUS_CALLER_LINE() 0u
+#endif
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+/**
+ * Lock contention profiling:
+ * a ProfiledMutex wraps any mutex and records per instance
+ * how often it was acquired, how long the threads waited for it
+ * and how long it was held.
+ * SynchronizedValue and WaiterImpl use it via their lock policies
+ * ProfiledLock and ProfiledStorage, which are only active if
+ * ASYNCHRONOUS_LOCK_PROFILING is defined, and the plain policies otherwise.
+ * NOTE: define it for the whole program (cmake -DASYNCHRONOUS_LOCK_PROFILING=ON),
+ *       never per translation unit, or the policies differ between them (ODR).
+ *       To profile a single lock, use details::ProfiledLock or details::ProfiledStorage.
+ * All living profiles are listed in the LockProfileRegistry.
+ */
+
+/**
+ * where the user took a lock:
+ * as a default argument, LockSite::current() is the place of the call
+ */
+struct LockSite
+{
+    const char* file = nullptr;
+    unsigned    line = 0;
+
+    static LockSite current(const char* file = ASYNCHRONOUS_CALLER_FILE(),
+                            unsigned line = ASYNCHRONOUS_CALLER_LINE())
+    { return LockSite{file, line}; }
+
+    bool isKnown() const { return (file != nullptr); }
+};
+
+std::ostream& operator << (std::ostream& s, const LockSite& site);
+
+/**
+ * the statistics of one lock
+ */
+struct LockStats
+{
+    using duration_t = std::chrono::nanoseconds;
+    using site_t = std::pair<LockSite, duration_t>;     //!< where the lock was taken and the hold time
+
+    std::string         name;
+    size_t              acquisitions = 0;
+    size_t              contentions = 0;    //!< acquisitions that had to wait
+    duration_t          waitTime{0};
+    duration_t          maxWaitTime{0};
+    duration_t          holdTime{0};
+    duration_t          maxHoldTime{0};
+    std::vector<site_t> longHolds;          //!< a sample of the holds above the threshold
+};
+
+std::ostream& operator << (std::ostream& s, const LockStats& stats);
+
+//------------------------------------------------------------------------------
+/**
+ * the counters of one lock, registered in the LockProfileRegistry while alive
+ */
+class LockProfile
+{
+public:
+    using clock_t = std::chrono::steady_clock;
+    using duration_t = LockStats::duration_t;
+
+    static constexpr size_t maxLongHolds = 8;
+
+private:
+    mutable std::mutex          ivMutex;    // for the name and the long holds
+    std::string                 ivName;
+    std::vector<LockStats::site_t> ivLongHolds;
+    size_t                      ivNextLongHold;
+
+    std::atomic<size_t>         ivAcquisitions;
+    std::atomic<size_t>         ivContentions;
+    std::atomic<long long>      ivWaitTime;
+    std::atomic<long long>      ivMaxWaitTime;
+    std::atomic<long long>      ivHoldTime;
+    std::atomic<long long>      ivMaxHoldTime;
+
+public:
+    explicit LockProfile(std::string name = std::string());
+    ~LockProfile();
+
+    LockProfile(const LockProfile&) = delete;
+    LockProfile& operator = (const LockProfile&) = delete;
+
+    void setName(std::string name);
+
+    /**
+     * @param wait how long the thread waited for the lock (0 if not contended)
+     */
+    void acquired(duration_t wait);
+
+    /**
+     * @param hold how long the lock was held
+     * @param site where the lock was taken (maybe unknown)
+     */
+    void released(duration_t hold, const LockSite& site);
+
+    LockStats getStats() const;
+};
+
+//------------------------------------------------------------------------------
+/**
+ * the list of all living lock profiles
+ */
+class LockProfileRegistry
+{
+public:
+    using duration_t = LockStats::duration_t;
+
+private:
+    mutable std::mutex          ivMutex;
+    std::vector<LockProfile*>   ivProfiles;
+    std::atomic<long long>      ivLongHoldThreshold;
+
+    LockProfileRegistry();
+
+public:
+    static LockProfileRegistry& instance();
+
+    void add(LockProfile* profile);
+    void remove(LockProfile* profile);
+
+    /**
+     * holds longer than this are sampled with their call site
+     */
+    void setLongHoldThreshold(duration_t threshold);
+    duration_t getLongHoldThreshold() const;
+
+    /**
+     * @return the statistics of all living locks
+     */
+    std::vector<LockStats> getStats() const;
+
+    /**
+     * @param count how many
+     * @return the locks with the most wait time first
+     */
+    std::vector<LockStats> getTopOffenders(size_t count) const;
+
+    /**
+     * print the top offenders
+     * @param s stream to print to
+     * @param count how many
+     */
+    void report(std::ostream& s, size_t count = 10) const;
+};
+
+namespace details {
+//******************************************************************************
+/**
+ * the site for the next lock of this thread,
+ * set by the functions that take the lock for the user (see setLockSite)
+ */
+inline LockSite& pendingLockSite()
+{
+    static thread_local LockSite site;
+    return site;
+}
+
+inline LockSite takeLockSite()
+{
+    auto& pending = pendingLockSite();
+    auto site = pending;
+    pending = LockSite();
+    return site;
+}
+
+//******************************************************************************
+}  // namespace details
+
+//------------------------------------------------------------------------------
+/**
+ * wraps a mutex (exclusive or shared) and feeds its LockProfile
+ * the long holds are sampled with the site given to setLockSite
+ * right before the lock, and with an unknown site otherwise
+ * NOTE: for shared locks only the acquisitions and the wait time are recorded
+ */
+template<typename MUTEX>
+class ProfiledMutex
+{
+public:
+    using mutex_t = MUTEX;
+    using clock_t = LockProfile::clock_t;
+
+private:
+    mutex_t             ivMutex;
+    LockProfile         ivProfile;
+    clock_t::time_point ivLockedAt;     // only touched by the owner
+    LockSite            ivSite;         // only touched by the owner
+
+    static LockProfile::duration_t since(const clock_t::time_point& tp)
+    { return std::chrono::duration_cast<LockProfile::duration_t>(clock_t::now() - tp); }
+
+    void locked(const LockSite& site)
+    {
+        ivLockedAt = clock_t::now();
+        ivSite = site;
+    }
+
+public:
+    ProfiledMutex() :
+        ivMutex(),
+        ivProfile(),
+        ivLockedAt(),
+        ivSite()
+    {}
+
+    void setName(std::string name) { ivProfile.setName(std::move(name)); }
+    LockStats getStats() const { return ivProfile.getStats(); }
+
+    void lock()
+    {
+        const auto site = details::takeLockSite();
+        if (ivMutex.try_lock())
+        { ivProfile.acquired(LockProfile::duration_t{0}); }
+        else
+        {
+            auto start = clock_t::now();
+            ivMutex.lock();
+            ivProfile.acquired(since(start));
+        }
+        locked(site);
+    }
+
+    bool try_lock()
+    {
+        const auto site = details::takeLockSite();
+        if (not ivMutex.try_lock()) { return false; }
+        ivProfile.acquired(LockProfile::duration_t{0});
+        locked(site);
+        return true;
+    }
+
+    void unlock()
+    {
+        auto hold = since(ivLockedAt);
+        auto site = ivSite;
+        ivMutex.unlock();
+        ivProfile.released(hold, site);
+    }
+
+    void lock_shared()
+    {
+        details::takeLockSite();    // not recorded, but do not leave it for the next lock
+        if (ivMutex.try_lock_shared())
+        { ivProfile.acquired(LockProfile::duration_t{0}); }
+        else
+        {
+            auto start = clock_t::now();
+            ivMutex.lock_shared();
+            ivProfile.acquired(since(start));
+        }
+    }
+
+    bool try_lock_shared()
+    {
+        details::takeLockSite();
+        if (not ivMutex.try_lock_shared()) { return false; }
+        ivProfile.acquired(LockProfile::duration_t{0});
+        return true;
+    }
+
+    void unlock_shared() { ivMutex.unlock_shared(); }
+};
+
+namespace details {
+//******************************************************************************
+template<typename T>
+struct is_profiled : std::false_type {};
+
+template<typename MUTEX>
+struct is_profiled< ProfiledMutex<MUTEX> > : std::true_type {};
+
+/**
+ * name the profile of the mutex, if it has one
+ */
+template<typename MUTEX>
+inline void setProfileName(MUTEX& mutex, std::string name)
+{
+    if constexpr (is_profiled<MUTEX>::value) { mutex.setName(std::move(name)); }
+}
+
+/**
+ * tell the profile of the mutex (if it has one), where the next lock is taken
+ */
+template<typename MUTEX>
+inline void setLockSite(const MUTEX&, const LockSite& site)
+{
+    if constexpr (is_profiled<MUTEX>::value) { pendingLockSite() = site; }
+    else { (void) site; }
+}
+
+//******************************************************************************
+}  // namespace details
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
@@ -0,0 +1,190 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/executor.hpp"
+#include "asynchronous/start_threads.hpp"
+#include "asynchronous/work_stealing_pool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <future>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+/**
+ * @return the pool the parallel_invoke and parallel_for without executor run on
+ *         (one thread per core, created with the first use)
+ */
+inline WorkStealingPool& getDefaultPool()
+{
+    static WorkStealingPool pool;
+    return pool;
+}
+
+namespace details {
+//******************************************************************************
+template<typename EXECUTOR, typename TUPLE, size_t... INDEX>
+inline void parallelInvoke(EXECUTOR& executor, TUPLE& funcs, std::index_sequence<INDEX...>)
+{
+    // all but the last one go to the executor
+    std::array< std::future<void>, sizeof...(INDEX) > futures{
+        { executeAsync(executor, [&funcs]() { std::get<INDEX>(funcs)(); })... } };
+
+    // the calling thread runs the last one itself
+    std::exception_ptr failure;
+    try
+    { std::get<sizeof...(INDEX)>(funcs)(); }
+    catch(...)
+    { failure = std::current_exception(); }
+
+    // helps with pending jobs while waiting, so nested calls do not block a worker
+    for(auto& future : futures) { asynchronous::wait(executor, future); }
+    for(auto& future : futures) { future.get(); }
+
+    if (failure) { std::rethrow_exception(failure); }
+}
+
+/**
+ * true for indexes and random access iterators
+ */
+template<typename ITERATOR, typename = void>
+struct is_random_access : std::is_integral<ITERATOR> { };
+
+template<typename ITERATOR>
+struct is_random_access<ITERATOR, std::void_t<typename std::iterator_traits<ITERATOR>::iterator_category> > :
+    std::is_base_of< std::random_access_iterator_tag, typename std::iterator_traits<ITERATOR>::iterator_category > { };
+
+template<typename EXECUTOR, typename ITERATOR, typename FUNC>
+inline void parallelFor(EXECUTOR& executor, ITERATOR begin, ITERATOR end, size_t grain, FUNC& func)
+{
+    const auto size = static_cast<size_t>(end - begin);
+    if (size <= grain)
+    {
+        for(auto it = begin; it != end; ++it)
+        {
+            if constexpr (std::is_integral<ITERATOR>::value) { func(it); }
+            else { func(*it); }
+        }
+        return;
+    }
+
+    const auto middle = begin + static_cast<decltype(end - begin)>(size / 2);
+    auto funcs = std::forward_as_tuple(
+            [&]() { parallelFor(executor, begin, middle, grain, func); },
+            [&]() { parallelFor(executor, middle, end, grain, func); } );
+    parallelInvoke(executor, funcs, std::make_index_sequence<1>{});
+}
+
+//******************************************************************************
+}  // namespace details
+
+/**
+ * @brief run all functions in parallel and return when all are done:
+ *        the last one runs in the calling thread, the others on the executor.
+ *        While waiting, the calling thread runs pending jobs of the executor
+ *        (if it has runPendingJob, like WorkStealingPool), so nested calls
+ *        from inside a job run on the same workers instead of blocking them.
+ *        If functions threw, the first one's exception (in the order of the parameters)
+ *        is rethrown, after all are done.
+ *
+ * @example:
+ *     asynchronous::WorkStealingPool pool;
+ *     asynchronous::parallel_invoke(pool, [&]{ sort(left); }, [&]{ sort(right); });
+ *
+ * @param executor to run the functions on
+ * @param funcs callables without parameters, they are not copied
+ */
+template<typename EXECUTOR, typename... FUNCS, typename = enable_if_executor_t<EXECUTOR> >
+inline void parallel_invoke(EXECUTOR& executor, FUNCS&&... funcs)
+{
+    if constexpr (sizeof...(FUNCS) > 0)
+    {
+        auto tuple = std::forward_as_tuple(std::forward<FUNCS>(funcs)...);
+        details::parallelInvoke(executor, tuple, std::make_index_sequence<sizeof...(FUNCS) - 1>{});
+    }
+}
+
+/**
+ * @brief same as above, on the default pool
+ */
+template<typename FUNC, typename... FUNCS, typename = std::enable_if_t< not is_executor_v<FUNC> > >
+inline void parallel_invoke(FUNC&& func, FUNCS&&... funcs)
+{ parallel_invoke(getDefaultPool(), std::forward<FUNC>(func), std::forward<FUNCS>(funcs)...); }
+
+//------------------------------------------------------------------------------
+/**
+ * @brief call func for every element of the range in parallel:
+ *        the range is split in halves (see parallel_invoke),
+ *        until a part has at most grain elements, that are done in a loop.
+ *        So the work adapts to the workers, and nested calls share them.
+ *
+ * @example:
+ *     asynchronous::parallel_for(pool, size_t{0}, values.size(), 1024,
+ *                                [&](size_t i) { values[i] *= 2; });
+ *
+ * @param executor to run the parts on
+ * @param begin first index or random access iterator
+ * @param end behind the last index or iterator
+ * @param grain the size of a part that is not split any more (at least 1)
+ * @param func called as func(index) for indexes, or func(element) for iterators
+ */
+template<typename EXECUTOR, typename ITERATOR, typename FUNC, typename = enable_if_executor_t<EXECUTOR> >
+inline void parallel_for(EXECUTOR& executor, ITERATOR begin, ITERATOR end, size_t grain, FUNC&& func)
+{
+    static_assert( details::is_random_access<ITERATOR>::value,
+                   "parallel_for needs indexes or random access iterators" );
+
+    if (not (begin < end)) { return; }
+    details::parallelFor(executor, begin, end, std::max<size_t>(grain, 1), func);
+}
+
+/**
+ * @brief same as above, for all elements of the container
+ */
+template<typename EXECUTOR, typename CONTAINER, typename FUNC, typename = enable_if_executor_t<EXECUTOR> >
+inline void parallel_for(EXECUTOR& executor, CONTAINER& container, size_t grain, FUNC&& func)
+{ parallel_for(executor, std::begin(container), std::end(container), grain, std::forward<FUNC>(func)); }
+
+/**
+ * @brief same as above, on the default pool
+ */
+template<typename ITERATOR, typename FUNC, typename = std::enable_if_t< not is_executor_v<ITERATOR> > >
+inline void parallel_for(ITERATOR begin, ITERATOR end, size_t grain, FUNC&& func)
+{ parallel_for(getDefaultPool(), begin, end, grain, std::forward<FUNC>(func)); }
+
+template<typename CONTAINER, typename FUNC, typename = std::enable_if_t< not is_executor_v<CONTAINER> > >
+inline void parallel_for(CONTAINER& container, size_t grain, FUNC&& func)
+{ parallel_for(getDefaultPool(), container, grain, std::forward<FUNC>(func)); }
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
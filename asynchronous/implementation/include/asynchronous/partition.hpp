@@ -0,0 +1,273 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <mutex>
+#include <type_traits>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+/**
+ * This class describes how the elements of a range are handed out
+ * to the threads working on it (like the OpenMP "schedule" clause)
+ *  - static_chunk(n): chunks of n elements are assigned round robin
+ *                     to the threads up front, no synchronization at all
+ *                     (n = 0 gives every thread one contiguous block)
+ *  - dynamic(n):      every thread claims the next n elements when it is done
+ *  - guided(n):       like dynamic, but the chunks start big and shrink
+ *                     with the remaining elements down to n
+ *  - automatic:       (the default) picks one of the above from the range size
+ */
+class Partition
+{
+public:
+    enum class Kind
+    {
+        automatic,
+        static_chunk,
+        dynamic,
+        guided
+    };
+
+    /**
+     * ranges with less elements per thread than this are handed out
+     * one element at a time by the automatic partition, because
+     * with only a few elements each of them is probably expensive
+     */
+    static constexpr size_t autoMinElementsPerThread = 4;
+
+private:
+    Kind    ivKind;
+    size_t  ivChunkSize;
+
+public:
+    explicit Partition(Kind kind = Kind::automatic, size_t chunkSize = 0) :
+        ivKind(kind),
+        ivChunkSize(chunkSize)
+    {}
+
+    Kind getKind() const { return ivKind; }
+    size_t getChunkSize() const { return ivChunkSize; }
+
+    /**
+     * @param size number of elements in the range
+     * @param threadCount number of threads working on the range
+     * @return a partition that is not automatic and has a chunk size
+     */
+    Partition resolve(size_t size, size_t threadCount) const
+    {
+        threadCount = std::max<size_t>(threadCount, 1);
+        switch(ivKind)
+        {
+        case Kind::automatic:
+            if (size < threadCount * autoMinElementsPerThread)
+            { return Partition{Kind::dynamic, 1}; }
+            return Partition{Kind::guided, 1};
+
+        case Kind::static_chunk:
+            if (ivChunkSize == 0)
+            { return Partition{ivKind, std::max<size_t>(1, (size + threadCount - 1) / threadCount)}; }
+            return *this;
+
+        default:
+            return Partition{ivKind, std::max<size_t>(1, ivChunkSize)};
+        }
+    }
+};
+
+/**
+ * @param chunkSize number of elements in each chunk, 0 means one block per thread
+ * @return a static partition
+ */
+inline Partition static_chunk(size_t chunkSize = 0)
+{ return Partition{Partition::Kind::static_chunk, chunkSize}; }
+
+/**
+ * @param chunkSize number of elements a thread claims at once
+ * @return a dynamic partition
+ */
+inline Partition dynamic(size_t chunkSize = 1)
+{ return Partition{Partition::Kind::dynamic, chunkSize}; }
+
+/**
+ * @param minChunkSize the smallest number of elements a thread claims at once
+ * @return a guided partition
+ */
+inline Partition guided(size_t minChunkSize = 1)
+{ return Partition{Partition::Kind::guided, minChunkSize}; }
+
+namespace details {
+//******************************************************************************
+
+/**
+ * this class can be used to walk thread-safe through an iterator range
+ * handing out the chunks defined by a Partition
+ * NOTE: the static partition needs random access iterators,
+ *       for all others it falls back to a dynamic partition of the same chunk size
+ */
+template<typename ITERATOR>
+class PartitionWalker
+{
+public:
+    using iterator = ITERATOR;
+    using mutex_t = std::mutex;
+    using lock_t = std::unique_lock<mutex_t>;
+
+    struct Range
+    {
+        iterator first;
+        iterator last;
+        size_t   offset;    //!< the index of first in the whole range
+    };
+
+private:
+    using category_t = typename std::iterator_traits<iterator>::iterator_category;
+    static constexpr bool isRandomAccess = std::is_base_of_v<std::random_access_iterator_tag, category_t>;
+
+    const iterator      ivBegin;
+    const size_t        ivSize;
+    const size_t        ivThreadCount;
+    const Partition     ivPartition;
+    std::atomic_bool    ivStopped;
+
+    // the state of the static partition
+    std::atomic_size_t  ivNextSlot;
+
+    // the state of the dynamic and guided partition
+    mutex_t             ivMutex;
+    iterator            ivPos;
+    size_t              ivOffset;
+
+    lock_t getLock() { return lock_t(ivMutex); }
+
+    size_t getChunkSize(size_t remaining) const
+    {
+        const auto chunkSize = ivPartition.getChunkSize();
+        if (ivPartition.getKind() != Partition::Kind::guided) { return chunkSize; }
+        return std::max(chunkSize, (remaining + ivThreadCount - 1) / ivThreadCount);
+    }
+
+    Range getRange(size_t offset, size_t count) const
+    {
+        using diff_t = typename std::iterator_traits<iterator>::difference_type;
+        const auto first = ivBegin + static_cast<diff_t>(offset);
+        return Range{first, first + static_cast<diff_t>(count), offset};
+    }
+
+    /**
+     * the slots of the static partition are claimed by the threads,
+     * so if a thread could not be started, its slot is done
+     * by the first thread, that is done with its own slot
+     */
+    template<typename FUNC>
+    void walkStatic(FUNC&& func)
+    {
+        const auto chunkSize = ivPartition.getChunkSize();
+        const auto stride = chunkSize * ivThreadCount;
+
+        for(auto slot = ivNextSlot++; slot < ivThreadCount; slot = ivNextSlot++)
+        {
+            for(auto offset = slot * chunkSize; offset < ivSize; offset += stride)
+            {
+                if (ivStopped.load(std::memory_order_relaxed)) { return; }
+                func(getRange(offset, std::min(chunkSize, ivSize - offset)));
+            }
+        }
+    }
+
+public:
+    /**
+     * @param begin the start of the range
+     * @param size number of elements in the range
+     * @param threadCount the number of threads that are supposed to work on the range
+     * @param partition how to hand out the elements
+     */
+    explicit PartitionWalker(iterator begin, size_t size, size_t threadCount, const Partition& partition) :
+            ivBegin(begin),
+            ivSize(size),
+            ivThreadCount(std::max<size_t>(threadCount, 1)),
+            ivPartition(partition.resolve(size, threadCount)),
+            ivStopped(false),
+            ivNextSlot(0),
+            ivMutex(),
+            ivPos(std::move(begin)),
+            ivOffset(0)
+    {}
+
+    /**
+     * @param range is set to the next chunk, if there is one
+     * @return false if all elements were handed out already
+     */
+    bool getNext(Range& range)
+    {
+        if (ivStopped.load(std::memory_order_relaxed)) { return false; }
+
+        auto lck = getLock();
+
+        if (ivOffset >= ivSize) { return false; }
+
+        const auto count = std::min(getChunkSize(ivSize - ivOffset), ivSize - ivOffset);
+        range.first = ivPos;
+        std::advance(ivPos, count);
+        range.last = ivPos;
+        range.offset = ivOffset;
+        ivOffset += count;
+        return true;
+    }
+
+    /**
+     * call func(range) for every chunk this thread gets
+     * this is the main loop of every thread working on the range
+     * @param func callable as func(const Range&)
+     */
+    template<typename FUNC>
+    void walk(FUNC&& func)
+    {
+        if constexpr (isRandomAccess)
+        {
+            if (ivPartition.getKind() == Partition::Kind::static_chunk)
+            { return walkStatic(std::forward<FUNC>(func)); }
+        }
+
+        Range range;
+        while(getNext(range)) { func(range); }
+    }
+
+    /**
+     * do not hand out any further chunks
+     */
+    void stop() { ivStopped = true; }
+};
+
+//******************************************************************************
+}  // namespace details
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
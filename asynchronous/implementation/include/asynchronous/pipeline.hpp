@@ -0,0 +1,599 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/queue.hpp"
+#include "asynchronous/start_threads.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+/**
+ * defines in which order a pipeline stage hands its results to the next stage
+ */
+enum class StageOrder
+{
+    unordered,  //!< as soon as they are done, the fastest
+    ordered     //!< in the order they were pushed into the pipeline
+};
+
+/**
+ * the statistics of one pipeline stage
+ */
+struct StageStats
+{
+    using duration_t = std::chrono::steady_clock::duration;
+
+    std::string name;
+    size_t      threadCount = 0;
+    size_t      processed = 0;      //!< number of values the function returned for
+    size_t      failed = 0;         //!< number of values the function threw for
+    size_t      queueDepth = 0;     //!< number of values waiting in the input queue
+    size_t      maxQueueDepth = 0;  //!< maximum number of values that were waiting at once
+    size_t      queueCapacity = 0;  //!< capacity of the input queue
+    duration_t  busyTime{};         //!< time spent in the function, summed over all threads
+    duration_t  elapsed{};          //!< time since the stage was started
+
+    /**
+     * @return processed values per second
+     */
+    double getThroughput() const
+    {
+        const auto seconds = std::chrono::duration<double>(elapsed).count();
+        return (seconds > 0) ? static_cast<double>(processed) / seconds : 0.0;
+    }
+
+    /**
+     * @return the share of time all threads of this stage were busy [0..1]
+     *         a stage close to 1 with a full input queue is the bottleneck
+     */
+    double getUtilization() const
+    {
+        const auto available = std::chrono::duration<double>(elapsed).count() * static_cast<double>(threadCount);
+        return (available > 0) ? std::chrono::duration<double>(busyTime).count() / available : 0.0;
+    }
+
+    friend std::ostream& operator << (std::ostream& s, const StageStats& stats)
+    {
+        return s << stats.name
+                 << ": threads=" << stats.threadCount
+                 << ", processed=" << stats.processed
+                 << ", failed=" << stats.failed
+                 << ", queue=" << stats.queueDepth << '/' << stats.queueCapacity
+                 << " (max " << stats.maxQueueDepth << ')'
+                 << ", throughput=" << stats.getThroughput() << "/s"
+                 << ", utilization=" << stats.getUtilization();
+    }
+};
+
+namespace details {
+//******************************************************************************
+
+/**
+ * the values travel through the pipeline with the sequence number
+ * they got when they were pushed into the pipeline.
+ * A value that could not be computed travels on as an empty value,
+ * so ordered stages do not wait for it.
+ */
+template<typename T>
+struct Sequenced
+{
+    size_t              sequence = 0;
+    std::optional<T>    value;
+};
+
+template<typename T>
+using SequencedQueue = SharedQueue< Sequenced<T> >;
+
+/**
+ * limits the values in flight in front of the ordered stages:
+ * the producer blocks while its sequence is a window ahead of the
+ * sequence an ordered stage waits for, so the re-ordering is bounded.
+ * The workers of the ordered stage are not blocked, because the value
+ * with the missing sequence might be queued behind the values they hold.
+ */
+class ReorderWindow
+{
+private:
+    struct Entry
+    {
+        size_t next;    // the sequence the stage waits for
+        size_t size;    // the window of the stage
+    };
+
+    std::mutex              ivMutex;
+    std::condition_variable ivCondition;
+    std::vector<Entry>      ivEntries;
+    bool                    ivClosed = false;
+
+    bool isOpen(size_t sequence) const
+    {
+        for(const auto& entry : ivEntries)
+        {
+            if ( (sequence >= entry.next) && (sequence - entry.next >= entry.size) ) { return false; }
+        }
+        return true;
+    }
+
+public:
+    /**
+     * @param size of the window of the new ordered stage
+     * @return the index of the stage
+     */
+    size_t addStage(size_t size)
+    {
+        std::lock_guard<std::mutex> l(ivMutex);
+        ivEntries.push_back( Entry{0, std::max<size_t>(size, 1)} );
+        return ivEntries.size() - 1;
+    }
+
+    /**
+     * the stage handed over all values before this sequence
+     * @param index of the stage
+     * @param next the sequence it waits for now
+     */
+    void advance(size_t index, size_t next)
+    {
+        { std::lock_guard<std::mutex> l(ivMutex); ivEntries[index].next = next; }
+        ivCondition.notify_all();
+    }
+
+    /**
+     * blocks as long as the sequence is out of the window of any ordered stage
+     * @return false if the window was closed
+     */
+    bool wait(size_t sequence)
+    {
+        std::unique_lock<std::mutex> l(ivMutex);
+        ivCondition.wait(l, [this, sequence] { return ivClosed || isOpen(sequence); });
+        return not ivClosed;
+    }
+
+    void close()
+    {
+        { std::lock_guard<std::mutex> l(ivMutex); ivClosed = true; }
+        ivCondition.notify_all();
+    }
+};
+
+/**
+ * the producer side of a pipeline,
+ * it is kept in a unique_ptr to keep the pipeline movable
+ */
+template<typename IN>
+struct PipelineInput
+{
+    std::mutex                          ivMutex;
+    size_t                              ivNextSequence = 0;
+    std::optional< SequencedQueue<IN> > ivWriter;
+    std::shared_ptr<ReorderWindow>      ivWindow = std::make_shared<ReorderWindow>();
+};
+
+//------------------------------------------------------------------------------
+class PipelineStage
+{
+public:
+    virtual ~PipelineStage() = default;
+
+    virtual StageStats getStats() const = 0;
+};
+
+/**
+ * @brief one stage of the pipeline:
+ *        threadCount threads pop the values from the input queue,
+ *        call func on them and push the results into the output queue.
+ *        Every thread holds a writer of the output queue, so the output
+ *        queue is finished as soon as the input queue is finished and
+ *        all threads are done.
+ */
+template<typename IN, typename OUT, typename FUNC>
+class TransformStage : public PipelineStage
+{
+public:
+    using input_t = typename SequencedQueue<IN>::reader_t;
+    using output_t = SequencedQueue<OUT>;
+    using clock_t = std::chrono::steady_clock;
+
+private:
+    using mutex_t = std::mutex;
+    using lock_t = std::unique_lock<mutex_t>;
+
+    const std::string   ivName;
+    const StageOrder    ivOrder;
+    const clock_t::time_point ivStart;
+    input_t             ivInput;
+    FUNC                ivFunc;
+
+    std::atomic_size_t  ivProcessed;
+    std::atomic_size_t  ivFailed;
+    std::atomic<clock_t::rep> ivBusyTime;
+
+    // re-ordering for StageOrder::ordered
+    mutex_t             ivMutex;
+    size_t              ivNextSequence;
+    std::map< size_t, Sequenced<OUT> > ivPending;
+    bool                ivDraining;         // one thread hands the pending values over
+    size_t              ivActiveWorkers;
+    std::shared_ptr<ReorderWindow> ivWindow;
+    size_t              ivWindowIndex;
+
+    JoiningThreads      ivThreads;
+
+    lock_t getLock() { return lock_t{ivMutex}; }
+
+    Sequenced<OUT> compute(Sequenced<IN>& in)
+    {
+        Sequenced<OUT> out;
+        out.sequence = in.sequence;
+        if (not in.value) { return out; }
+
+        const auto start = clock_t::now();
+        try
+        {
+            out.value.emplace( std::invoke(ivFunc, std::move(*in.value)) );
+            ++ivProcessed;
+        }
+        catch(...)
+        { ++ivFailed; }
+        ivBusyTime += (clock_t::now() - start).count();
+
+        return out;
+    }
+
+    /**
+     * hand the pending values over in sequence order.
+     * Only one thread drains at a time, so it can push without holding the lock
+     * and the other workers go on meanwhile.
+     * @param lck the lock of this stage, it is released while pushing
+     * @param output the queue of the next stage
+     * @param all true to skip missing sequences, when the input is finished
+     */
+    void drain(lock_t& lck, output_t& output, bool all)
+    {
+        ivDraining = true;
+        while (not ivPending.empty())
+        {
+            auto pos = ivPending.begin();
+            if ( (pos->first != ivNextSequence) && (not all) ) { break; }
+
+            auto out = std::move(pos->second);
+            ivPending.erase(pos);
+            ivNextSequence = out.sequence + 1;
+            if (ivWindow) { ivWindow->advance(ivWindowIndex, ivNextSequence); }
+
+            lck.unlock();
+            output->push_wait(std::move(out));
+            lck.lock();
+        }
+        ivDraining = false;
+    }
+
+    void forward(output_t& output, Sequenced<OUT>&& out)
+    {
+        if (ivOrder == StageOrder::unordered)
+        {
+            output->push_wait(std::move(out));
+            return;
+        }
+
+        auto lck = getLock();
+        ivPending.emplace(out.sequence, std::move(out));
+        if (not ivDraining) { drain(lck, output, false); }
+    }
+
+    void worker(output_t output)
+    {
+        while(auto r = ivInput->pop())
+        { forward(output, compute(r.value)); }
+
+        // the last worker hands over what is left,
+        // a sequence can be missing if a push failed on close
+        auto lck = getLock();
+        if ( (--ivActiveWorkers == 0) && (ivOrder == StageOrder::ordered) )
+        { drain(lck, output, true); }
+    }
+
+public:
+    /**
+     * @param window bounds the re-ordering of an ordered stage (or nullptr)
+     */
+    template<typename F>
+    explicit TransformStage(std::string name, size_t threadCount, StageOrder order,
+                            input_t input, const output_t& output, F&& func,
+                            std::shared_ptr<ReorderWindow> window = nullptr) :
+            ivName(std::move(name)),
+            ivOrder(order),
+            ivStart(clock_t::now()),
+            ivInput(std::move(input)),
+            ivFunc(std::forward<F>(func)),
+            ivProcessed(0),
+            ivFailed(0),
+            ivBusyTime(0),
+            ivMutex(),
+            ivNextSequence(0),
+            ivPending(),
+            ivDraining(false),
+            ivActiveWorkers(0),
+            ivWindow(std::move(window)),
+            ivWindowIndex(ivWindow ? ivWindow->addStage(output->getCapacity()) : 0),
+            ivThreads()
+    {
+        if (threadCount == 0)
+        { throw std::invalid_argument("Pipeline: stage " + ivName + " needs at least one thread"); }
+
+        ivThreads.reserve(threadCount);
+        for(size_t i = 0; i < threadCount; ++i)
+        {
+            { auto lck = getLock(); ++ivActiveWorkers; }
+            try
+            { ivThreads.start(&TransformStage::worker, this, output); }
+            catch(std::system_error&)
+            {
+                /*ignore if we can not start the thread*/
+                auto lck = getLock();
+                --ivActiveWorkers;
+            }
+        }
+
+        if (ivThreads.empty())
+        { throw std::runtime_error("Pipeline: stage " + ivName + " could not start any thread"); }
+    }
+
+    StageStats getStats() const override
+    {
+        auto l = ivInput->getLock();
+
+        StageStats stats;
+        stats.name = ivName;
+        stats.threadCount = ivThreads.size();
+        stats.processed = ivProcessed;
+        stats.failed = ivFailed;
+        stats.queueDepth = ivInput->size(l);
+        stats.maxQueueDepth = ivInput->getMaxQueueSize(l);
+        stats.queueCapacity = ivInput->getCapacity(l);
+        stats.busyTime = clock_t::duration{ivBusyTime.load()};
+        stats.elapsed = clock_t::now() - ivStart;
+        return stats;
+    }
+};
+
+//******************************************************************************
+}  // namespace details
+
+/**
+ * @brief a chain of stages connected by bounded queues
+ *        Every stage has its own threads and its own input queue.
+ *        A full queue blocks the stage (or producer) in front of it.
+ *        When the input of the pipeline is closed, every stage finishes
+ *        after its input queue is empty, and so the end of the input
+ *        propagates through the pipeline via notifyToFinish.
+ *
+ * @example:
+ *     auto pipeline = asynchronous::Pipeline<std::string>{100}
+ *                         .stage("parse", 4, 100, parse)
+ *                         .stage("square", 2, 100, square, asynchronous::StageOrder::ordered);
+ *
+ *     std::thread producer([&] { for(auto& line : lines) { pipeline.push(line); } pipeline.close(); });
+ *     while(auto r = pipeline.pop()) { consume(r.value); }
+ *     producer.join();
+ *
+ * NOTE: - the stages start working right away
+ *       - if the function of a stage throws, the value is dropped
+ *         and counted as failed in the stage statistics
+ *       - the destructor finishes all queues, so values still in the
+ *         pipeline are dropped. Close the input and pop until the
+ *         pipeline is empty, to get all results.
+ * @tparam IN the type of the values pushed into the pipeline
+ * @tparam OUT the type of the values popped from the pipeline
+ */
+template<typename IN, typename OUT = IN>
+class Pipeline
+{
+public:
+    static constexpr size_t unbounded = std::numeric_limits<size_t>::max();
+
+    using input_t = details::SequencedQueue<IN>;
+    using output_t = typename details::SequencedQueue<OUT>::reader_t;
+    using result_t = typename Queue<OUT>::result_t;
+    using State = typename result_t::State;
+
+private:
+    template<typename, typename> friend class Pipeline;
+
+    using stages_t = std::vector< std::unique_ptr<details::PipelineStage> >;
+    using finishers_t = std::vector< std::function<void()> >;
+
+    using Input = details::PipelineInput<IN>;
+
+    std::unique_ptr<Input>  ivInput;
+    output_t                ivOutput;
+    finishers_t             ivFinishers;
+    stages_t                ivStages;
+
+    explicit Pipeline(std::unique_ptr<Input> input, output_t output,
+                      finishers_t finishers, stages_t stages) :
+            ivInput(std::move(input)),
+            ivOutput(std::move(output)),
+            ivFinishers(std::move(finishers)),
+            ivStages(std::move(stages))
+    {}
+
+    static input_t createInput(size_t capacity)
+    {
+        input_t input;
+        input->setCapacity(capacity);
+        return input;
+    }
+
+    explicit Pipeline(input_t input) :
+            ivInput( new Input() ),
+            ivOutput( input.as_reader() ),
+            ivFinishers(),
+            ivStages()
+    {
+        ivInput->ivWriter.emplace( std::move(input) );
+    }
+
+public:
+    /**
+     * @param capacity of the input queue of the pipeline
+     */
+    explicit Pipeline(size_t capacity = unbounded) :
+            Pipeline( createInput(capacity) )
+    {}
+
+    Pipeline(Pipeline&&) = default;
+
+    ~Pipeline()
+    {
+        close();
+        for(auto& finish : ivFinishers) { finish(); }
+        // the destructors of the stages join their threads
+    }
+
+    /**
+     * add a stage to the end of the pipeline
+     * @param name of the stage, for the statistics
+     * @param threadCount number of threads of this stage
+     * @param capacity of the queue behind this stage,
+     *        for an ordered stage it also bounds the values waiting for re-ordering
+     * @param func will be called on every value, like
+     *        result = func(value);
+     * @param order in which the results are handed over
+     * @exception std::invalid_argument if threadCount is 0
+     * @return the pipeline with the new stage at the end
+     */
+    template<typename FUNC, typename RESULT = std::decay_t< std::invoke_result_t<std::decay_t<FUNC>&, OUT&&> > >
+    Pipeline<IN, RESULT> stage(std::string name, size_t threadCount, size_t capacity,
+                               FUNC&& func, StageOrder order = StageOrder::unordered) &&
+    {
+        using STAGE = details::TransformStage<OUT, RESULT, std::decay_t<FUNC> >;
+
+        // check before anything is moved, so the pipeline stays usable
+        if (threadCount == 0)
+        { throw std::invalid_argument("Pipeline: stage " + name + " needs at least one thread"); }
+
+        typename STAGE::output_t output;
+        output->setCapacity(capacity);
+
+        // the stage unblocks its threads, when the pipeline is destroyed
+        auto reader = output.as_reader();
+        ivFinishers.emplace_back( [reader] () mutable { reader->notifyToFinish(); } );
+
+        auto window = (order == StageOrder::ordered) ? ivInput->ivWindow : nullptr;
+        ivStages.emplace_back( new STAGE(std::move(name), threadCount, order,
+                                         std::move(ivOutput), output,
+                                         std::forward<FUNC>(func), std::move(window)) );
+
+        return Pipeline<IN, RESULT>{ std::move(ivInput), std::move(reader),
+                                     std::move(ivFinishers), std::move(ivStages) };
+    }
+
+    /**
+     * push a value into the pipeline
+     * blocks as long as the input queue is full,
+     * or the value is a capacity ahead of what an ordered stage waits for
+     * @return false if the pipeline is already closed (or closed while blocking)
+     */
+    template<typename... ARGS>
+    bool push(ARGS&&... args)
+    {
+        details::Sequenced<IN> value;
+        value.value.emplace(std::forward<ARGS>(args)...);
+
+        std::optional< typename input_t::reader_t > queue;
+        std::shared_ptr<details::ReorderWindow> window;
+        {
+            std::lock_guard lock{ivInput->ivMutex};
+            if (not ivInput->ivWriter) { return false; }
+
+            value.sequence = ivInput->ivNextSequence++;
+            queue.emplace( ivInput->ivWriter->as_reader() );
+            window = ivInput->ivWindow;
+        }
+
+        // the lock is not held while blocking, so close can interrupt us
+        if (not window->wait(value.sequence)) { return false; }
+        return (*queue)->push_wait(std::move(value));
+    }
+
+    /**
+     * no more values will be pushed, the stages finish
+     * as soon as all values are processed
+     * blocked pushes return false
+     */
+    void close()
+    {
+        if (not ivInput) { return; }
+
+        std::lock_guard lock{ivInput->ivMutex};
+        ivInput->ivWriter.reset();
+        ivInput->ivWindow->close();
+    }
+
+    /**
+     * blocks until the next result is available
+     * @return the result, or State::empty if the pipeline was closed
+     *         and all results were popped
+     */
+    result_t pop()
+    {
+        while(auto r = ivOutput->pop())
+        {
+            if (r.value.value) { return result_t{ std::move(*r.value.value) }; }
+        }
+        return result_t{ State::empty };
+    }
+
+    /**
+     * @return the statistics of all stages in pipeline order
+     */
+    std::vector<StageStats> getStats() const
+    {
+        std::vector<StageStats> result;
+        result.reserve(ivStages.size());
+        for(auto& stage : ivStages)
+        { result.push_back(stage->getStats()); }
+        return result;
+    }
+};
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
@@ -0,0 +1,272 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/start_threads.hpp"
+#include "asynchronous/traits/cacheline.hpp"
+
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+/**
+ * defines in which order the partial results of a reduction are combined
+ */
+enum class ReduceOrder
+{
+    unordered,      //!< each thread accumulates whatever it gets, the fastest
+    deterministic   //!< the grouping depends only on the number of elements,
+                    //!< so floating point results do not change from run to run,
+                    //!< and the element order is kept (no commutativity needed)
+};
+
+namespace details {
+//******************************************************************************
+
+struct Identity
+{
+    template<typename T>
+    T&& operator () (T&& t) const { return std::forward<T>(t); }
+};
+
+/**
+ * @brief This class reduces the elements of an iterator range in chunks
+ *        of a fixed size (a dynamic Partition).
+ *        Every chunk is accumulated locally and then merged into a slot
+ *        ReduceOrder::unordered       -> one slot per thread
+ *        ReduceOrder::deterministic   -> one slot per chunk
+ *        Each slot lives in its own cache line, so the threads
+ *        do not invalidate each other's partial results.
+ * @tparam ITERATOR of the range
+ * @tparam T type of the result
+ * @tparam REDUCE callable as T = reduceOp(T, T)
+ * @tparam TRANSFORM callable as T = transformOp(element)
+ */
+template<typename ITERATOR, typename T, typename REDUCE, typename TRANSFORM>
+class Reducer
+{
+public:
+    using walker_t = PartitionWalker<ITERATOR>;
+    using range_t = typename walker_t::Range;
+    using partial_t = std::optional<T>;
+    using slot_t = traits::CacheLinePadded<partial_t>;
+
+    /**
+     * upper limit of chunks for ReduceOrder::deterministic
+     */
+    static constexpr size_t deterministicChunkCount = 1024;
+
+    /**
+     * chunks per thread for ReduceOrder::unordered
+     */
+    static constexpr size_t chunksPerThread = 16;
+
+private:
+    const ReduceOrder   ivOrder;
+    const size_t        ivChunkSize;
+    REDUCE&             ivReduceOp;
+    TRANSFORM&          ivTransformOp;
+    walker_t            ivWalker;
+    std::vector<slot_t> ivSlots;
+    std::atomic_size_t  ivNextThread;
+    std::mutex          ivMutex;
+    std::exception_ptr  ivException;
+
+    static size_t getChunkSize(ReduceOrder order, size_t size, size_t threadCount)
+    {
+        if (order == ReduceOrder::deterministic)
+        { return std::max<size_t>(1, (size + deterministicChunkCount - 1) / deterministicChunkCount); }
+        return std::max<size_t>(1, size / (threadCount * chunksPerThread));
+    }
+
+    template<typename VALUE>
+    void accumulate(partial_t& partial, VALUE&& value)
+    {
+        if (partial)
+        { *partial = std::invoke(ivReduceOp, std::move(*partial), std::forward<VALUE>(value)); }
+        else
+        { partial.emplace(std::forward<VALUE>(value)); }
+    }
+
+    void setException(std::exception_ptr exception)
+    {
+        std::unique_lock lock{ivMutex};
+        if (not ivException) { ivException = std::move(exception); }
+    }
+
+    void reduceRange(const range_t& range, size_t threadIndex)
+    {
+        partial_t partial;
+        for(auto pos = range.first; pos != range.last; ++pos)
+        { accumulate(partial, std::invoke(ivTransformOp, *pos)); }
+
+        const auto slot = (ivOrder == ReduceOrder::deterministic) ? (range.offset / ivChunkSize) : threadIndex;
+        accumulate(ivSlots[slot].value, std::move(*partial));
+    }
+
+public:
+    explicit Reducer(ReduceOrder order, ITERATOR begin, size_t size, size_t threadCount,
+                     REDUCE& reduceOp, TRANSFORM& transformOp) :
+            ivOrder(order),
+            ivChunkSize(getChunkSize(order, size, threadCount)),
+            ivReduceOp(reduceOp),
+            ivTransformOp(transformOp),
+            ivWalker(std::move(begin), size, threadCount, dynamic(ivChunkSize)),
+            ivSlots( (order == ReduceOrder::deterministic)
+                        ? (size + ivChunkSize - 1) / ivChunkSize
+                        : threadCount ),
+            ivNextThread(0),
+            ivMutex(),
+            ivException()
+    {}
+
+    /**
+     * the actual worker function, it is called once in every thread
+     * the first exception stops all workers and is kept for "getResult"
+     */
+    void run()
+    {
+        const auto threadIndex = ivNextThread++;
+        range_t range;
+
+        try
+        {
+            while(ivWalker.getNext(range))
+            { reduceRange(range, threadIndex); }
+        }
+        catch(...)
+        {
+            setException(std::current_exception());
+            ivWalker.stop();
+        }
+    }
+
+    /**
+     * combine all partial results in slot order
+     * @param init the initial value of the reduction
+     * @return the result of the reduction
+     */
+    T getResult(T init)
+    {
+        if (ivException) { std::rethrow_exception(ivException); }
+
+        for(auto& slot : ivSlots)
+        {
+            if (slot.value)
+            { init = std::invoke(ivReduceOp, std::move(init), std::move(*slot.value)); }
+        }
+        return init;
+    }
+};
+
+//******************************************************************************
+}  // namespace details
+
+/**
+ * @brief reduces the transformed elements of the container
+ *        in parallel on at most threadCount threads (incl. the calling thread)
+ *        Every thread keeps its own partial result and
+ *        all partial results are combined once at the end.
+ *        Any exception thrown by reduceOp or transformOp stops all threads
+ *        and is re-thrown in the calling thread.
+ *
+ * @example:
+ *     std::vector<int> numbers = { 1,2,3,4,5 };
+ *     auto sum = asynchronous::transform_reduce(2, numbers, 0,
+ *                                               std::plus<>{},
+ *                                               [](int a) { return a*a; });
+ *     EXPECT_EQ(55, sum);
+ *
+ * @param threadCount number of threads to use (incl. the calling thread)
+ * @param container any container supporting std::begin/end
+ * @param init the initial value, it is combined with the partial results
+ * @param reduceOp has to be associative, called as
+ *        T = reduceOp(T, T);
+ *        it has to be commutative as well for ReduceOrder::unordered,
+ *        ReduceOrder::deterministic keeps the order of the elements (init first)
+ * @param transformOp will be called on each element in the container, like
+ *        T = transformOp(element);
+ * @param order see ReduceOrder
+ * @exception std::invalid_argument if threadCount is 0 but the container is not empty
+ * @return the result of the reduction
+ */
+template<typename CONTAINER, typename T, typename REDUCE, typename TRANSFORM>
+inline T transform_reduce(size_t threadCount,
+                          CONTAINER&& container,
+                          T init,
+                          REDUCE&& reduceOp,
+                          TRANSFORM&& transformOp,
+                          ReduceOrder order = ReduceOrder::unordered)
+{
+    using ITERATOR = decltype( std::begin(container) );
+    using REDUCER = details::Reducer<ITERATOR, T,
+                                     std::remove_reference_t<REDUCE>,
+                                     std::remove_reference_t<TRANSFORM> >;
+
+    const auto size = details::getSize(container);
+    if (size == 0) { return init; }
+
+    if (threadCount == 0)
+    { throw std::invalid_argument("transform_reduce: zero threads can not reduce any element"); }
+
+    REDUCER reducer(order, std::begin(container), size, threadCount, reduceOp, transformOp);
+    run_threads(std::min(threadCount, size), &REDUCER::run, &reducer);
+    return reducer.getResult(std::move(init));
+}
+
+/**
+ * @brief reduces the elements of the container in parallel
+ *        see transform_reduce
+ * @param threadCount number of threads to use (incl. the calling thread)
+ * @param container any container supporting std::begin/end
+ * @param init the initial value, it is combined with the partial results
+ * @param reduceOp has to be associative
+ *        (and commutative for ReduceOrder::unordered)
+ * @param order see ReduceOrder
+ * @return the result of the reduction
+ */
+template<typename CONTAINER, typename T, typename REDUCE = std::plus<> >
+inline T reduce(size_t threadCount,
+                CONTAINER&& container,
+                T init,
+                REDUCE&& reduceOp = REDUCE{},
+                ReduceOrder order = ReduceOrder::unordered)
+{
+    return transform_reduce(threadCount,
+                            std::forward<CONTAINER>(container),
+                            std::move(init),
+                            std::forward<REDUCE>(reduceOp),
+                            details::Identity{},
+                            order);
+}
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include "asynchronous/partition.hpp"
 #include "asynchronous/traits/types.hpp"
 
 namespace asynchronous {
@@ -30,4 +31,16 @@ namespace asynchronous {
      */
     void run_tasks(Tasks & tasks, size_t threadcount);
 
+    /**
+     * Run tasks in a limited number of threads.
+     * It returns when all tasks are done
+
+     * @param  tasks        Container of std::packaged_task.
+     *                      The container must offer an index operator
+     * @param  threadnumber Maximum number of threads
+     * @param  partition    How the tasks are handed out to the threads
+     * @exception std::invalid_argument if the number or threads or task are insane
+     */
+    void run_tasks(Tasks & tasks, size_t threadcount, const Partition & partition);
+
 }
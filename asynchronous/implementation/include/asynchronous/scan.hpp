@@ -0,0 +1,211 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/start_threads.hpp"
+
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+namespace details {
+//******************************************************************************
+
+/**
+ * @brief This class implements a parallel prefix scan in three steps
+ *        1. the range is split into one block per thread and
+ *           the total of every block is calculated in parallel
+ *        2. the totals are scanned in the calling thread,
+ *           which gives the carry into every block
+ *        3. every block is scanned in parallel starting with its carry
+ *        So every element is read twice and written once.
+ * @tparam INPUT random access iterator
+ * @tparam OUTPUT random access iterator
+ * @tparam T the type of the totals
+ * @tparam OP associative binary operation
+ */
+template<typename INPUT, typename OUTPUT, typename T, typename OP>
+class BlockScanner
+{
+public:
+    using totals_t = std::vector< std::optional<T> >;
+
+    /**
+     * ranges smaller than that are not worth the threads
+     */
+    static constexpr size_t minBlockSize = 4096;
+
+private:
+    INPUT               ivFirst;
+    OUTPUT              ivOut;
+    const size_t        ivSize;
+    const size_t        ivThreadCount;
+    OP&                 ivOp;
+    std::vector<size_t> ivBounds;
+
+    size_t getBlockCount() const { return ivBounds.size() - 1; }
+
+    INPUT getInput(size_t index) const { return getIterator(ivFirst, ivBounds[index]); }
+    OUTPUT getOutput(size_t index) const { return getIterator(ivOut, ivBounds[index]); }
+
+    /**
+     * @return the carry into each block, the first block gets init
+     */
+    totals_t getCarries(std::optional<T> init) const
+    {
+        const auto blockCount = getBlockCount();
+
+        totals_t totals(blockCount);
+        for_each_index(ivThreadCount, blockCount - 1,
+                       [this, &totals](size_t index)
+                       {
+                           auto first = getInput(index);
+                           T total = *first;
+                           totals[index] = std::accumulate(++first, getInput(index+1),
+                                                           std::move(total), ivOp);
+                       });
+
+        totals_t carries(blockCount);
+        carries[0] = std::move(init);
+        for(size_t index = 1; index < blockCount; ++index)
+        {
+            if (carries[index-1])
+            { carries[index] = std::invoke(ivOp, *carries[index-1], std::move(*totals[index-1])); }
+            else
+            { carries[index] = std::move(totals[index-1]); }
+        }
+        return carries;
+    }
+
+public:
+    explicit BlockScanner(size_t threadCount, INPUT first, size_t size, OUTPUT out, OP& op) :
+            ivFirst(std::move(first)),
+            ivOut(std::move(out)),
+            ivSize(size),
+            ivThreadCount(std::max<size_t>(threadCount, 1)),
+            ivOp(op),
+            ivBounds(getBlockBounds(size, std::max<size_t>(1, std::min(ivThreadCount, size / minBlockSize))))
+    {}
+
+    OUTPUT inclusive()
+    {
+        const auto carries = getCarries(std::nullopt);
+
+        for_each_index(ivThreadCount, getBlockCount(),
+                       [this, &carries](size_t index)
+                       {
+                           if (carries[index])
+                           { std::inclusive_scan(getInput(index), getInput(index+1), getOutput(index), ivOp, *carries[index]); }
+                           else
+                           { std::inclusive_scan(getInput(index), getInput(index+1), getOutput(index), ivOp); }
+                       });
+
+        return getIterator(ivOut, ivSize);
+    }
+
+    OUTPUT exclusive(T init)
+    {
+        const auto carries = getCarries(std::move(init));
+
+        for_each_index(ivThreadCount, getBlockCount(),
+                       [this, &carries](size_t index)
+                       { std::exclusive_scan(getInput(index), getInput(index+1), getOutput(index), *carries[index], ivOp); });
+
+        return getIterator(ivOut, ivSize);
+    }
+};
+
+template<typename ITERATOR>
+inline void checkRandomAccess()
+{
+    using category_t = typename std::iterator_traits<ITERATOR>::iterator_category;
+    static_assert(std::is_base_of_v<std::random_access_iterator_tag, category_t>,
+                  "asynchronous scans need random access iterators");
+}
+
+//******************************************************************************
+}  // namespace details
+
+/**
+ * @brief computes the inclusive prefix scan of [first, last) into out
+ *        in parallel on at most threadCount threads (incl. the calling thread)
+ *        like std::inclusive_scan, out may be equal to first.
+ *        NOTE: op should not throw, for the same reasons as in "run_threads"
+ * @param threadCount number of threads to use (incl. the calling thread)
+ * @param first random access iterator to the input range
+ * @param last random access iterator to the input range
+ * @param out random access iterator to the output range
+ * @param op has to be associative
+ * @return iterator to the element past the last element written
+ */
+template<typename INPUT, typename OUTPUT, typename OP = std::plus<> >
+inline OUTPUT inclusive_scan(size_t threadCount, INPUT first, INPUT last, OUTPUT out, OP op = OP{})
+{
+    details::checkRandomAccess<INPUT>();
+    details::checkRandomAccess<OUTPUT>();
+
+    using T = typename std::iterator_traits<INPUT>::value_type;
+    const auto size = static_cast<size_t>( std::distance(first, last) );
+    if (size == 0) { return out; }
+
+    details::BlockScanner<INPUT, OUTPUT, T, OP> scanner(threadCount, std::move(first), size, std::move(out), op);
+    return scanner.inclusive();
+}
+
+/**
+ * @brief computes the exclusive prefix scan of [first, last) into out
+ *        in parallel on at most threadCount threads (incl. the calling thread)
+ *        like std::exclusive_scan, out may be equal to first.
+ *        NOTE: op should not throw, for the same reasons as in "run_threads"
+ * @param threadCount number of threads to use (incl. the calling thread)
+ * @param first random access iterator to the input range
+ * @param last random access iterator to the input range
+ * @param out random access iterator to the output range
+ * @param init the first value written to out
+ * @param op has to be associative
+ * @return iterator to the element past the last element written
+ */
+template<typename INPUT, typename OUTPUT, typename T, typename OP = std::plus<> >
+inline OUTPUT exclusive_scan(size_t threadCount, INPUT first, INPUT last, OUTPUT out, T init, OP op = OP{})
+{
+    details::checkRandomAccess<INPUT>();
+    details::checkRandomAccess<OUTPUT>();
+
+    const auto size = static_cast<size_t>( std::distance(first, last) );
+    if (size == 0) { return out; }
+
+    details::BlockScanner<INPUT, OUTPUT, T, OP> scanner(threadCount, std::move(first), size, std::move(out), op);
+    return scanner.exclusive(std::move(init));
+}
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
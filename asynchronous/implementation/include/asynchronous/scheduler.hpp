@@ -23,11 +23,15 @@
 #pragma once
 
 //******************************************************************************
+#include "asynchronous/awaitable.hpp"
+#include "asynchronous/executor.hpp"
+
 #include <mutex>
 #include <condition_variable>
 #include <queue>
 #include <thread>
 #include <functional>
+#include <tuple>
 
 //******************************************************************************
 namespace asynchronous {
@@ -221,6 +225,41 @@ public:
     {
         delay_until(Clock::now()+ duration, std::forward<FUNC>(func));
     }
+
+    /**
+     * awaitable to suspend a C++20 coroutine until this time point:
+     *      co_await scheduler.sleep_until(tp, executor);
+     * the default executor resumes the coroutine in the scheduler thread,
+     * a time point in the past does not suspend it at all
+     * NOTE: if the scheduler is cleared or destroyed before,
+     *       the coroutine is never resumed
+     * @param tp
+     * @param executor the coroutine is resumed on
+     * @return an awaitable
+     */
+    template<typename EXECUTOR = InlineExecutor>
+    auto sleep_until(TimePoint tp, EXECUTOR&& executor = EXECUTOR{})
+    {
+        return details::makeAwaiter<void>(
+            [tp] () { return tp <= Clock::now(); },
+            [this, tp, exec = std::tuple<EXECUTOR>(std::forward<EXECUTOR>(executor))]
+            (auto callback) mutable
+            {
+                delay_until(tp, [exec, callback] () mutable
+                                { std::get<0>(exec).execute(std::move(callback)); } );
+            } );
+    }
+
+    /**
+     * awaitable to suspend a C++20 coroutine for this duration:
+     *      co_await scheduler.sleep_for(duration, executor);
+     * @param duration
+     * @param executor the coroutine is resumed on
+     * @return an awaitable
+     */
+    template<typename EXECUTOR = InlineExecutor>
+    auto sleep_for(const Clock::duration& duration, EXECUTOR&& executor = EXECUTOR{})
+    { return sleep_until(Clock::now() + duration, std::forward<EXECUTOR>(executor)); }
 };
 
 //******************************************************************************
@@ -0,0 +1,207 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/cappedqueue.hpp"
+#include "asynchronous/shared_resource.hpp"
+
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <vector>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+/**
+ * in which order a Selector looks at its queues
+ */
+enum class Fairness
+{
+    ordered,    //!< the first ready queue wins, so the first queues have priority
+    roundRobin  //!< start after the last selected queue, so no queue starves
+};
+
+/**
+ * waits on several CappedQueues (or SharedCappedQueues) at once:
+ * select returns the index of a queue, that has a value or is finished.
+ * All queues notify one shared notification object, so there is no polling.
+ * A finished queue is reported once and then ignored.
+ *      Selector selector(Fairness::roundRobin, q1, q2);
+ *      for(auto i = selector.select(); i != Selector::finished; i = selector.select())
+ *      { ... pop from queue i with try_pop ... }
+ * NOTE: with several consumers per queue, the value may be gone
+ *       before try_pop is called (it returns State::empty then)
+ * NOTE: a Selector is meant to be used by one thread,
+ *       it is neither copyable nor movable
+ */
+class Selector
+{
+public:
+    using clock_t = std::chrono::steady_clock;
+    using duration_t = clock_t::duration;
+    using timepoint_t = clock_t::time_point;
+
+    static constexpr size_t finished = std::numeric_limits<size_t>::max();      //!< all queues are finished
+    static constexpr size_t timeout = std::numeric_limits<size_t>::max() - 1;   //!< the timeout occurred
+
+private:
+    enum class State { waiting, ready, finished };
+
+    struct Entry
+    {
+        std::function<State()>  getState;
+        std::function<void()>   detach;
+        bool                    reported;   // the finish was reported
+    };
+
+    details::QueueNotifier  ivNotifier;
+    Fairness                ivFairness;
+    size_t                  ivNext;
+    std::vector<Entry>      ivEntries;
+
+    size_t select(const timepoint_t* timepoint)
+    {
+        while (true)
+        {
+            // read the generation before looking at the queues,
+            // so every push after the look wakes us up
+            const auto generation = ivNotifier.getGeneration();
+            const auto count = ivEntries.size();
+            const auto start = (ivFairness == Fairness::roundRobin) ? ivNext : 0;
+
+            bool open = false;
+            for(size_t i = 0; i < count; ++i)
+            {
+                const auto index = (start + i) % count;
+                auto& entry = ivEntries[index];
+                if (entry.reported) { continue; }
+
+                open = true;
+                const auto state = entry.getState();
+                if (state == State::waiting) { continue; }
+
+                entry.reported = (state == State::finished);
+                ivNext = index + 1;
+                return index;
+            }
+
+            if (not open) { return finished; }
+            if (not ivNotifier.wait(generation, timepoint)) { return timeout; }
+        }
+    }
+
+public:
+    explicit Selector(Fairness fairness = Fairness::ordered) :
+        ivNotifier(),
+        ivFairness(fairness),
+        ivNext(0),
+        ivEntries()
+    {}
+
+    template<typename... STATES>
+    explicit Selector(Fairness fairness, const Reader<STATES>&... queues) :
+        Selector(fairness)
+    {
+        (add(queues), ...);
+    }
+
+    template<typename... STATES>
+    explicit Selector(const Reader<STATES>&... queues) :
+        Selector(Fairness::ordered, queues...)
+    {}
+
+    ~Selector()
+    {
+        for(auto& entry : ivEntries) { entry.detach(); }
+    }
+
+    Selector(const Selector&) = delete;
+    Selector& operator = (const Selector&) = delete;
+
+    /**
+     * add another queue, the selector keeps it alive as a reader
+     * @param queue
+     * @return the index select returns for this queue
+     */
+    template<typename STATE>
+    size_t add(const Reader<STATE>& queue)
+    {
+        Reader<STATE> reader(queue);
+        reader->attachNotifier(&ivNotifier);
+
+        ivEntries.push_back(Entry{
+            [reader]()
+            {
+                auto l = reader->getLock();
+                if (not reader->empty(l)) { return State::ready; }
+                if (reader->isDone(l)) { return State::finished; }
+                return State::waiting;
+            },
+            [reader, notifier = &ivNotifier]() mutable { reader->detachNotifier(notifier); },
+            false });
+        return ivEntries.size() - 1;
+    }
+
+    /**
+     * @return the number of queues
+     */
+    size_t size() const { return ivEntries.size(); }
+
+    /**
+     * blocks until one of the queues has a value or is finished
+     * @return the index of that queue,
+     *         or Selector::finished if all queues are finished (and reported)
+     */
+    size_t select() { return select(nullptr); }
+
+    /**
+     * same as select but times out when the timepoint is reached
+     * @param timepoint
+     * @return the index, Selector::finished, or Selector::timeout
+     */
+    size_t select_until(const timepoint_t& timepoint) { return select(&timepoint); }
+
+    size_t select_for(const duration_t& duration)
+    { return select_until(clock_t::now() + duration); }
+};
+
+//------------------------------------------------------------------------------
+/**
+ * one-shot version of Selector::select:
+ * blocks until one of the queues has a value or is finished
+ * @param queues
+ * @return the index of the first such queue (in the order of the parameters)
+ */
+template<typename... STATES>
+inline size_t select(const Reader<STATES>&... queues)
+{
+    Selector selector(Fairness::ordered, queues...);
+    return selector.select();
+}
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
@@ -0,0 +1,133 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <type_traits>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+/**
+ * The read path policies for SynchronizedValue and WaiterImpl.
+ * The owner calls beginWrite/endWrite around every modification
+ * (while holding its lock), and asks "lockFree" if it can use "read"
+ * instead of taking the lock.
+ */
+
+/**
+ * the default: readers take the lock like the writers, writes cost nothing extra
+ */
+struct LockedRead
+{
+    static constexpr bool lockFree = false;
+
+    void beginWrite() {}
+    void endWrite() {}
+};
+
+/**
+ * a sequence lock: readers never block the writers.
+ * Every write makes the sequence odd while it is running and even again
+ * afterwards. The reader copies the value and retries if the sequence
+ * was odd or has changed in the meantime.
+ * NOTE: only for trivially copyable values, as the reader copies the bytes
+ *       of the value while a writer might change them
+ */
+class SeqLockRead
+{
+private:
+    std::atomic<unsigned int> ivSequence{0};
+
+public:
+    static constexpr bool lockFree = true;
+
+    SeqLockRead() = default;
+    SeqLockRead(const SeqLockRead&) = delete;
+    SeqLockRead& operator = (const SeqLockRead&) = delete;
+
+    // NOTE: the writers are serialized by the lock of the owner
+    void beginWrite()
+    {
+        ivSequence.store(ivSequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    void endWrite()
+    { ivSequence.store(ivSequence.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    /**
+     * @param value the value to copy, that is protected by the owner's lock
+     * @return a consistent copy of the value
+     */
+    template<typename T>
+    T read(const T& value) const
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "the seqlock read path needs a trivially copyable value");
+
+        alignas(T) unsigned char buffer[sizeof(T)];
+        for (unsigned int tries = 1; ; ++tries)
+        {
+            auto before = ivSequence.load(std::memory_order_acquire);
+            if ((before & 1u) == 0)
+            {
+                std::memcpy(buffer, &value, sizeof(T));
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (ivSequence.load(std::memory_order_relaxed) == before)
+                { return *std::launder(reinterpret_cast<T*>(buffer)); }
+            }
+            if ((tries % 64) == 0) { std::this_thread::yield(); }
+        }
+    }
+};
+
+namespace details {
+//******************************************************************************
+/**
+ * calls endWrite even if the modification throws
+ */
+template<typename READ>
+class WriteGuard
+{
+private:
+    READ& ivRead;
+
+public:
+    explicit WriteGuard(READ& read) : ivRead(read) { ivRead.beginWrite(); }
+    ~WriteGuard() { ivRead.endWrite(); }
+
+    WriteGuard(const WriteGuard&) = delete;
+    WriteGuard& operator = (const WriteGuard&) = delete;
+};
+
+//******************************************************************************
+}  // namespace details
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
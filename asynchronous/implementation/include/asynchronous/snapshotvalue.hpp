@@ -0,0 +1,319 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/traits/cacheline.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+namespace details {
+//******************************************************************************
+/**
+ * the epoch based reclamation shared by all SnapshotValues:
+ * every thread that reads gets its own slot (on its own cache line)
+ * and publishes the epoch it started reading in.
+ * An object retired in epoch e can be deleted,
+ * once no slot is active with an epoch <= e.
+ */
+class EpochDomain
+{
+public:
+    using epoch_t = std::uint64_t;
+
+    struct alignas(traits::cacheLineSize) Slot
+    {
+        std::atomic<epoch_t> epoch{0};      //!< 0 = not reading
+        std::atomic<bool>    used{false};   //!< owned by a thread
+        size_t               nesting = 0;   //!< only touched by the owning thread
+    };
+
+private:
+    std::atomic<epoch_t>                ivEpoch{1};
+    mutable std::mutex                  ivMutex;
+    std::vector< std::unique_ptr<Slot> > ivSlots;  // never shrinks, slots are reused
+
+    /**
+     * the slot of the calling thread (in the shared domain)
+     * it is given back when the thread ends
+     */
+    static inline thread_local Slot* tlsSlot = nullptr;
+
+    Slot& acquireSlot();
+
+public:
+    /**
+     * @return the domain all SnapshotValues share
+     */
+    static EpochDomain& instance()
+    {
+        static EpochDomain domain;
+        return domain;
+    }
+
+    /**
+     * @return the slot of the calling thread
+     */
+    Slot& thisThreadSlot()
+    {
+        if (not tlsSlot) { tlsSlot = &acquireSlot(); }
+        return *tlsSlot;
+    }
+
+    /**
+     * start a read section in the calling thread (can be nested)
+     */
+    void enter(Slot& slot)
+    {
+        if (slot.nesting++ == 0)
+        { slot.epoch.store(ivEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst); }
+    }
+
+    /**
+     * end a read section in the calling thread
+     */
+    void leave(Slot& slot)
+    {
+        if (--slot.nesting == 0)
+        { slot.epoch.store(0, std::memory_order_release); }
+    }
+
+    /**
+     * start a new epoch
+     * @return the epoch that just ended (the one to retire the old objects in)
+     */
+    epoch_t advance() { return ivEpoch.fetch_add(1, std::memory_order_seq_cst); }
+
+    /**
+     * @return the oldest epoch a reader is still reading in
+     *         (or the current epoch if nobody reads)
+     */
+    epoch_t oldestActive() const;
+};
+
+/**
+ * a read section, as long as this object exists
+ * NOTE: it has to be destroyed by the thread that created it
+ */
+class EpochGuard
+{
+private:
+    EpochDomain*       ivDomain;
+    EpochDomain::Slot* ivSlot;
+
+public:
+    explicit EpochGuard(EpochDomain& domain = EpochDomain::instance()) :
+        ivDomain(&domain),
+        ivSlot(&domain.thisThreadSlot())
+    {
+        ivDomain->enter(*ivSlot);
+    }
+
+    ~EpochGuard()
+    {
+        if (ivSlot) { ivDomain->leave(*ivSlot); }
+    }
+
+    EpochGuard(const EpochGuard&) = delete;
+    EpochGuard& operator = (const EpochGuard&) = delete;
+
+    EpochGuard(EpochGuard&& other) :
+        ivDomain(other.ivDomain),
+        ivSlot(other.ivSlot)
+    {
+        other.ivSlot = nullptr;
+    }
+
+    EpochGuard& operator = (EpochGuard&&) = delete;
+};
+
+//******************************************************************************
+}  // namespace details
+
+/**
+ * A read-mostly value (RCU like):
+ * the readers get an immutable snapshot without any lock
+ * and without touching a shared reference count,
+ * the writers copy the current value, modify the copy and publish it.
+ * The replaced values are deleted once no reader can see them anymore.
+ */
+template<typename T>
+class SnapshotValue
+{
+public:
+    using value_t = T;
+    using epoch_t = details::EpochDomain::epoch_t;
+
+    /**
+     * the immutable snapshot of the value
+     * The value stays valid as long as this object exists.
+     * NOTE: it has to be destroyed by the thread that created it,
+     *       and should be short living, as it delays the deletion
+     *       of all replaced values (of all SnapshotValues)
+     */
+    class Snapshot
+    {
+    private:
+        details::EpochGuard ivGuard;
+        const value_t*      ivValue;
+
+        friend class SnapshotValue;
+
+        explicit Snapshot(const std::atomic<const value_t*>& current) :
+            ivGuard(),
+            ivValue(current.load(std::memory_order_seq_cst))
+        {}
+
+    public:
+        const value_t* get() const { return ivValue; }
+        const value_t* operator -> () const { return ivValue; }
+        const value_t& operator * () const { return *ivValue; }
+    };
+
+private:
+    struct Retired
+    {
+        epoch_t                         epoch;
+        std::unique_ptr<const value_t>  value;
+    };
+
+    std::atomic<const value_t*> ivCurrent;
+    mutable std::mutex          ivWriterMutex;
+    std::vector<Retired>        ivRetired;
+
+    using lock_t = std::unique_lock<std::mutex>;
+    lock_t getLock() const { return lock_t(ivWriterMutex); }
+
+    /**
+     * delete all retired values no reader can see anymore
+     * @return the number of values still retired
+     */
+    size_t reclaim(const lock_t&)
+    {
+        if (ivRetired.empty()) { return 0; }
+
+        const auto oldest = details::EpochDomain::instance().oldestActive();
+        auto iter = std::remove_if(ivRetired.begin(), ivRetired.end(),
+                                   [oldest](const Retired& r) { return r.epoch < oldest; });
+        ivRetired.erase(iter, ivRetired.end());
+        return ivRetired.size();
+    }
+
+    void publish(const lock_t& l, std::unique_ptr<const value_t> next)
+    {
+        std::unique_ptr<const value_t> old(ivCurrent.exchange(next.release(), std::memory_order_seq_cst));
+        ivRetired.push_back(Retired{ details::EpochDomain::instance().advance(), std::move(old) });
+        reclaim(l);
+    }
+
+public:
+    /**
+     * creates the value with these parameters
+     * @param args the parameters to the constructor of the value
+     */
+    template<typename... ARGS>
+    explicit SnapshotValue(ARGS&&... args) :
+        ivCurrent(new value_t(std::forward<ARGS>(args)...)),
+        ivWriterMutex(),
+        ivRetired()
+    {}
+
+    /**
+     * NOTE: there must be no snapshot left
+     */
+    ~SnapshotValue() { delete ivCurrent.load(); }
+
+    SnapshotValue(const SnapshotValue&) = delete;
+    SnapshotValue& operator = (const SnapshotValue&) = delete;
+
+    /**
+     * @return the current snapshot, this is wait-free
+     */
+    Snapshot read() const { return Snapshot(ivCurrent); }
+
+    /**
+     * @return a copy of the current value
+     */
+    value_t getValue() const { return *read(); }
+
+    /**
+     * replace the value by a modified copy
+     * the other writers are blocked meanwhile, but not the readers
+     * @param func called with a reference to the copy
+     */
+    template<typename FUNC>
+    void update(FUNC&& func)
+    {
+        auto l = getLock();
+        std::unique_ptr<value_t> next(new value_t(*ivCurrent.load()));
+        std::forward<FUNC>(func)(*next);
+        publish(l, std::move(next));
+    }
+
+    /**
+     * replace the value
+     * @param value the new value
+     */
+    template<typename VALUE>
+    void setValue(VALUE&& value)
+    {
+        std::unique_ptr<const value_t> next(new value_t(std::forward<VALUE>(value)));
+        auto l = getLock();
+        publish(l, std::move(next));
+    }
+
+    /**
+     * block until all replaced values are deleted,
+     * that is until all readers, that might see them, are gone
+     * NOTE: calling it while holding a snapshot in this thread deadlocks
+     */
+    void synchronize()
+    {
+        auto l = getLock();
+        while (reclaim(l) > 0) { std::this_thread::yield(); }
+    }
+
+    /**
+     * @return the number of replaced values, that are not yet deleted
+     */
+    size_t getRetiredCount() const
+    {
+        auto l = getLock();
+        return ivRetired.size();
+    }
+};
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
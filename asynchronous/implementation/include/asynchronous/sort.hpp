@@ -0,0 +1,258 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/start_threads.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+namespace details {
+//******************************************************************************
+
+/**
+ * @brief This class implements a parallel merge sort
+ *        1. the range is split into one block per thread
+ *           and every block is sorted with std::sort
+ *        2. neighboring blocks are merged pairwise into a buffer
+ *           and back, until only one block is left.
+ *           Every merge of two blocks is split again into smaller merges,
+ *           so all threads are busy, even in the last round.
+ * @tparam ITERATOR random access iterator
+ * @tparam COMPARE strict weak ordering
+ */
+template<typename ITERATOR, typename COMPARE>
+class MergeSorter
+{
+public:
+    using value_t = typename std::iterator_traits<ITERATOR>::value_type;
+    using buffer_t = std::vector<value_t>;
+
+    /**
+     * ranges smaller than that are not worth the threads
+     */
+    static constexpr size_t minBlockSize = 4096;
+
+private:
+    /**
+     * merge source [a0, a1) and [b0, b1) into destination [out, ...)
+     */
+    struct Merge
+    {
+        size_t a0;
+        size_t a1;
+        size_t b0;
+        size_t b1;
+        size_t out;
+    };
+    using merges_t = std::vector<Merge>;
+
+    ITERATOR            ivBegin;
+    const size_t        ivSize;
+    const size_t        ivThreadCount;
+    COMPARE&            ivCompare;
+    std::vector<size_t> ivBounds;
+    buffer_t            ivBuffer;
+
+    size_t getBlockCount() const { return ivBounds.size() - 1; }
+
+    /**
+     * split the merge of [a0, a1) and [b0, b1) into parts independent merges
+     * the longer range is split evenly and the other one is split
+     * at the matching positions, so the merge stays stable
+     */
+    template<typename SOURCE>
+    void splitMerge(SOURCE src, const Merge& merge, size_t parts, merges_t& merges) const
+    {
+        const auto sizeA = merge.a1 - merge.a0;
+        const auto sizeB = merge.b1 - merge.b0;
+        auto getOut = [&merge](size_t posA, size_t posB)
+                      { return merge.out + (posA - merge.a0) + (posB - merge.b0); };
+
+        size_t posA = merge.a0;
+        size_t posB = merge.b0;
+
+        for(size_t part = 1; (part < parts) && (sizeA + sizeB > 0); ++part)
+        {
+            size_t splitA;
+            size_t splitB;
+            if (sizeA >= sizeB)
+            {
+                splitA = merge.a0 + sizeA * part / parts;
+                splitB = getIndex(src, std::lower_bound(getIterator(src, posB),
+                                                        getIterator(src, merge.b1),
+                                                        *getIterator(src, splitA),
+                                                        ivCompare));
+            }
+            else
+            {
+                splitB = merge.b0 + sizeB * part / parts;
+                splitA = getIndex(src, std::upper_bound(getIterator(src, posA),
+                                                        getIterator(src, merge.a1),
+                                                        *getIterator(src, splitB),
+                                                        ivCompare));
+            }
+
+            merges.push_back(Merge{posA, splitA, posB, splitB, getOut(posA, posB)});
+            posA = splitA;
+            posB = splitB;
+        }
+
+        merges.push_back(Merge{posA, merge.a1, posB, merge.b1, getOut(posA, posB)});
+    }
+
+    template<typename SOURCE>
+    static size_t getIndex(SOURCE begin, SOURCE pos)
+    { return static_cast<size_t>( std::distance(begin, pos) ); }
+
+    /**
+     * merge every pair of neighboring runs of width blocks from src into dst
+     */
+    template<typename SOURCE, typename DESTINATION>
+    void mergeRound(SOURCE src, DESTINATION dst, size_t width)
+    {
+        const auto blockCount = getBlockCount();
+        const auto pairCount = (blockCount + 2*width - 1) / (2*width);
+        const auto parts = std::max<size_t>(1, ivThreadCount / pairCount);
+
+        merges_t merges;
+        merges.reserve(pairCount * parts);
+        for(size_t pair = 0; pair < pairCount; ++pair)
+        {
+            const auto first = pair * 2 * width;
+            const auto a0 = ivBounds[first];
+            const auto a1 = ivBounds[std::min(first + width, blockCount)];
+            const auto b1 = ivBounds[std::min(first + 2*width, blockCount)];
+            splitMerge(src, Merge{a0, a1, a1, b1, a0}, parts, merges);
+        }
+
+        for_each_index(ivThreadCount, merges.size(),
+                       [this, src, dst, &merges](size_t index)
+                       {
+                           const auto& m = merges[index];
+                           std::merge(std::make_move_iterator(getIterator(src, m.a0)),
+                                      std::make_move_iterator(getIterator(src, m.a1)),
+                                      std::make_move_iterator(getIterator(src, m.b0)),
+                                      std::make_move_iterator(getIterator(src, m.b1)),
+                                      getIterator(dst, m.out),
+                                      ivCompare);
+                       });
+    }
+
+public:
+    explicit MergeSorter(size_t threadCount, ITERATOR begin, size_t size, COMPARE& compare) :
+            ivBegin(std::move(begin)),
+            ivSize(size),
+            ivThreadCount(threadCount),
+            ivCompare(compare),
+            ivBounds(getBlockBounds(size, std::max<size_t>(1, std::min(threadCount, size / minBlockSize)))),
+            ivBuffer()
+    {}
+
+    void run()
+    {
+        const auto blockCount = getBlockCount();
+
+        for_each_index(ivThreadCount, blockCount,
+                       [this](size_t index)
+                       {
+                           std::sort(getIterator(ivBegin, ivBounds[index]),
+                                     getIterator(ivBegin, ivBounds[index+1]),
+                                     ivCompare);
+                       });
+
+        if (blockCount < 2) { return; }
+
+        ivBuffer.resize(ivSize);
+        bool inBuffer = false;
+        for(size_t width = 1; width < blockCount; width *= 2)
+        {
+            if (inBuffer) { mergeRound(ivBuffer.begin(), ivBegin, width); }
+            else          { mergeRound(ivBegin, ivBuffer.begin(), width); }
+            inBuffer = not inBuffer;
+        }
+
+        if (not inBuffer) { return; }
+
+        for_each_index(ivThreadCount, blockCount,
+                       [this](size_t index)
+                       {
+                           std::move(getIterator(ivBuffer.begin(), ivBounds[index]),
+                                     getIterator(ivBuffer.begin(), ivBounds[index+1]),
+                                     getIterator(ivBegin, ivBounds[index]));
+                       });
+    }
+};
+
+//******************************************************************************
+}  // namespace details
+
+/**
+ * @brief sorts the range [begin, end) in parallel on
+ *        at most threadCount threads (incl. the calling thread)
+ *        like std::sort the order of equal elements is not preserved
+ *        NOTE: the elements have to be default constructible and move assignable
+ *              because the merge needs a buffer of the same size as the range.
+ *        NOTE: compare should not throw, for the same reasons as in "run_threads"
+ * @param threadCount number of threads to use (incl. the calling thread)
+ * @param begin random access iterator
+ * @param end random access iterator
+ * @param compare strict weak ordering, like for std::sort
+ */
+template<typename ITERATOR, typename COMPARE = std::less<> >
+inline void sort(size_t threadCount, ITERATOR begin, ITERATOR end, COMPARE compare = COMPARE{})
+{
+    using category_t = typename std::iterator_traits<ITERATOR>::iterator_category;
+    static_assert(std::is_base_of_v<std::random_access_iterator_tag, category_t>,
+                  "asynchronous::sort needs random access iterators");
+
+    const auto size = static_cast<size_t>( std::distance(begin, end) );
+    details::MergeSorter<ITERATOR, COMPARE> sorter(std::max<size_t>(threadCount, 1),
+                                                   std::move(begin), size, compare);
+    sorter.run();
+}
+
+/**
+ * @brief sorts the container in parallel, see the iterator version
+ * @param threadCount number of threads to use (incl. the calling thread)
+ * @param container any container supporting std::begin/end with random access iterators
+ * @param compare strict weak ordering, like for std::sort
+ */
+template<typename CONTAINER, typename COMPARE = std::less<>,
+         typename = decltype( std::begin( std::declval<CONTAINER>()) ) >
+inline void sort(size_t threadCount, CONTAINER&& container, COMPARE compare = COMPARE{})
+{
+    asynchronous::sort(threadCount, std::begin(container), std::end(container), std::move(compare));
+}
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
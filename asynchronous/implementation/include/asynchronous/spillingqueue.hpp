@@ -0,0 +1,420 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/cappedqueue.hpp"
+#include "asynchronous/shared_resource.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+/**
+ * how a basic_spilling_queue writes a value to disk and reads it back:
+ *      static size_t size(const T& value);             // the bytes needed
+ *      static void write(const T& value, char* dest);  // write exactly size(value) bytes
+ *      static T read(const char* src, size_t size);    // create the value again
+ * This is implemented for trivially copyable types and std::string,
+ * specialize it for other types.
+ */
+template<typename T, typename ENABLE = void>
+struct SpillSerializer;
+
+template<typename T>
+struct SpillSerializer<T, std::enable_if_t< std::is_trivially_copyable<T>::value > >
+{
+    static size_t size(const T&) { return sizeof(T); }
+    static void write(const T& value, char* dest) { std::memcpy(dest, &value, sizeof(T)); }
+    static T read(const char* src, size_t)
+    {
+        T value;
+        std::memcpy(&value, src, sizeof(T));
+        return value;
+    }
+};
+
+template<>
+struct SpillSerializer<std::string>
+{
+    static size_t size(const std::string& value) { return value.size(); }
+    static void write(const std::string& value, char* dest) { std::memcpy(dest, value.data(), value.size()); }
+    static std::string read(const char* src, size_t size) { return std::string(src, size); }
+};
+
+namespace details {
+//******************************************************************************
+/**
+ * an append-only file mapped into memory, holding length prefixed records
+ * The file is created in the directory with a unique name
+ * and deleted by the destructor.
+ * NOTE: this needs mmap, other platforms throw std::runtime_error
+ */
+class SpillSegment
+{
+private:
+    std::string ivPath;
+    int         ivFile;
+    char*       ivData;
+    size_t      ivCapacity;
+    size_t      ivWriteOffset;
+    size_t      ivReadOffset;
+
+public:
+    using length_t = uint32_t;
+    static constexpr size_t headerSize = sizeof(length_t);
+
+    /**
+     * throws std::system_error if the file can not be created or mapped
+     * @param directory where to create the file ("" = the temp directory)
+     * @param capacity the size of the file
+     */
+    SpillSegment(const std::string& directory, size_t capacity);
+    ~SpillSegment();
+
+    SpillSegment(const SpillSegment&) = delete;
+    SpillSegment& operator = (const SpillSegment&) = delete;
+
+    /**
+     * @param size the size of the record
+     * @return a pointer to write the record to, or nullptr if it does not fit
+     */
+    char* append(size_t size);
+
+    /**
+     * @return true if there is a record to read
+     */
+    bool hasRecord() const { return ivReadOffset < ivWriteOffset; }
+
+    /**
+     * @param size gets the size of the next record
+     * @return a pointer to the next record, which is consumed by this
+     */
+    const char* next(size_t& size);
+
+    const std::string& getPath() const { return ivPath; }
+    size_t getCapacity() const { return ivCapacity; }
+};
+
+//******************************************************************************
+}  // namespace details
+
+/**
+ * This implements a thread-safe FIFO queue, that never drops a value:
+ * above the memory limit the values are serialized (see SpillSerializer)
+ * into append-only memory mapped segment files, and read back in FIFO order.
+ * A segment file is deleted as soon as all its values are popped.
+ * Once values are spilled, new values are spilled too (to keep the order),
+ * until the consumers caught up.
+ * The managed type has to be default constructable.
+ * The function "pop" is blocking ("try_pop" is not).
+ */
+template<typename T, typename SERIALIZER = SpillSerializer<T> >
+class basic_spilling_queue
+{
+public:
+    using mutex_t = std::mutex;
+    using lock_t = std::unique_lock<mutex_t>;
+
+    using value_t      = T;
+    using serializer_t = SERIALIZER;
+    using segment_t    = details::SpillSegment;
+
+    using clock_t = std::chrono::steady_clock;
+    using duration_t = clock_t::duration;
+    using timepoint_t = clock_t::time_point;
+
+    using PopResult = typename basic_capped_queue<value_t, std::numeric_limits<size_t>::max()>::PopResult;
+    using result_t = PopResult;
+
+    static constexpr size_t defaultMemoryLimit = 1024;
+    static constexpr size_t defaultSegmentSize = 1 << 20;
+
+private:
+    mutable mutex_t         ivMutex;
+    std::condition_variable ivQueueCond;
+    bool                    ivDone{false};
+
+    size_t                  ivMemoryLimit;
+    std::string             ivDirectory;
+    size_t                  ivSegmentSize;
+
+    std::deque<value_t>     ivMemory;
+    std::deque< std::unique_ptr<segment_t> > ivSegments;
+    size_t                  ivOnDisk{0};
+
+    size_t                  ivItemCount{0};
+    size_t                  ivDroppedItemCount{0};
+    size_t                  ivSpilledItemCount{0};
+    size_t                  ivSegmentCount{0};
+
+    /**
+     * check if pop() should wait on the queue for further steps
+     * @param synchronization object for this queue
+     * @return true if the worker should wait
+     */
+    bool shouldWait(const lock_t& l) const
+    {
+        if (isDone(l)) return false;
+        if (empty(l)) return true;
+        return false;
+    }
+
+    void spill(const lock_t&, const value_t& value)
+    {
+        const auto size = serializer_t::size(value);
+
+        char* dest = ivSegments.empty() ? nullptr : ivSegments.back()->append(size);
+        if (dest == nullptr)
+        {
+            const auto capacity = std::max(ivSegmentSize, size + segment_t::headerSize);
+            ivSegments.emplace_back(new segment_t(ivDirectory, capacity));
+            ++ivSegmentCount;
+            dest = ivSegments.back()->append(size);
+        }
+
+        serializer_t::write(value, dest);
+        ++ivOnDisk;
+        ++ivSpilledItemCount;
+    }
+
+    value_t unspill(const lock_t&)
+    {
+        auto& segment = *ivSegments.front();
+        size_t size = 0;
+        const char* src = segment.next(size);
+        value_t value = serializer_t::read(src, size);
+
+        --ivOnDisk;
+        if (not segment.hasRecord()) { ivSegments.pop_front(); }   // deletes the file
+        return value;
+    }
+
+public:
+    /**
+     * @param memoryLimit the number of values kept in memory
+     * @param directory where to create the segment files ("" = the temp directory)
+     * @param segmentSize the size of one segment file
+     */
+    explicit basic_spilling_queue(size_t memoryLimit = defaultMemoryLimit,
+                                  std::string directory = std::string(),
+                                  size_t segmentSize = defaultSegmentSize) :
+        ivMemoryLimit(memoryLimit),
+        ivDirectory(std::move(directory)),
+        ivSegmentSize(segmentSize)
+    {}
+
+    /**
+     * @return synchronization object for this queue
+     */
+    lock_t getLock() const { return lock_t{ivMutex}; }
+
+    /**
+     * notify all consumers
+     */
+    void notify_all() { ivQueueCond.notify_all(); }
+
+    /**
+     * sets ivDone and notifies all consumers to end
+     */
+    void notifyToFinish()
+    {
+        { auto l = getLock(); ivDone = true; }
+        notify_all();
+    }
+
+    /**
+     * destructor: signal all consumers to end, and delete the segment files
+     */
+    ~basic_spilling_queue() { notifyToFinish(); }
+
+    //--------------------------------------------------------------------------
+    /**
+     * @return the next element in the queue, from memory or from disk
+     *         if the queue is empty, it returns PopResult::State::empty
+     * @param synchronization object for this queue
+     */
+    PopResult try_pop(const lock_t& l)
+    {
+        if (not ivMemory.empty())
+        {
+            PopResult result{std::move(ivMemory.front())};
+            ivMemory.pop_front();
+            return result;
+        }
+
+        if (ivOnDisk > 0) { return PopResult{unspill(l)}; }
+        return PopResult{PopResult::State::empty};
+    }
+
+    PopResult try_pop() { return try_pop(getLock()); }
+
+    /**
+     * blocks until at least one value was en-queued
+     * or the queue is finished
+     * @return the value, or PopResult::State::empty if the queue is finished
+     */
+    PopResult pop()
+    {
+        auto l = getLock();
+
+        while( shouldWait(l) )
+        {
+            try { ivQueueCond.wait(l); }
+            catch(...) {}
+        }
+
+        return try_pop(l);
+    }
+
+    /**
+     * same as pop but times out when the timepoint is reached
+     * @param timepoint
+     * @return PopResult
+     *          -> state = timeout if a timeout occurred
+     */
+    PopResult pop_wait_until(const timepoint_t& end)
+    {
+        auto l = getLock();
+        while (shouldWait(l))
+        {
+            try
+            {
+                if (ivQueueCond.wait_until(l, end) ==  std::cv_status::timeout)
+                { return PopResult{ PopResult::State::timeout }; }
+            }
+            catch(...) {}
+        }
+        return try_pop(l);
+    }
+
+    PopResult pop_wait_for(const duration_t& duration)
+    { return pop_wait_until( clock_t::now() + duration ); }
+
+    /**
+     * en-queue the value, in memory or on disk
+     * throws std::system_error if a segment file can not be created
+     * @return false if the queue is finished (the value is dropped)
+     * @param synchronization object for this queue
+     * @param args to the constructor of value
+     */
+    template<typename... ARGS>
+    bool push_no_notify(const lock_t& l, ARGS&&... args)
+    {
+        ++ivItemCount;
+        if (isDone(l))
+        {
+            ++ivDroppedItemCount;
+            return false;
+        }
+
+        if ( (ivOnDisk == 0) && (ivMemory.size() < ivMemoryLimit) )
+        { ivMemory.emplace_back(std::forward<ARGS>(args)...); }
+        else
+        { spill(l, value_t(std::forward<ARGS>(args)...)); }
+        return true;
+    }
+
+    template<typename... ARGS>
+    bool push(ARGS&&... args)
+    {
+        auto l = getLock();
+        auto result = push_no_notify(l, std::forward<ARGS>(args)...);
+        l.unlock();
+
+        ivQueueCond.notify_one();
+        return result;
+    }
+
+    //--------------------------------------------------------------------------
+    /**
+     * provide the queue state functions
+     */
+    bool isDone(const lock_t&) const { return ivDone; }
+    bool empty(const lock_t&)  const { return ivMemory.empty() && (ivOnDisk == 0); }
+    size_t size(const lock_t&) const { return ivMemory.size() + ivOnDisk; }
+
+    size_t getItemCount(const lock_t&) const { return ivItemCount; }
+    size_t getDroppedItemCount(const lock_t&) const { return ivDroppedItemCount; }
+
+    /**
+     * @return the number of values currently on disk
+     */
+    size_t getSpilledSize(const lock_t&) const { return ivOnDisk; }
+
+    /**
+     * @return the number of values, that were ever written to disk
+     */
+    size_t getSpilledItemCount(const lock_t&) const { return ivSpilledItemCount; }
+
+    /**
+     * @return the number of segment files, that were ever created
+     */
+    size_t getSegmentCount(const lock_t&) const { return ivSegmentCount; }
+
+    /**
+     * @return the number of segment files, that exist now
+     */
+    size_t getLiveSegmentCount(const lock_t&) const { return ivSegments.size(); }
+
+    //--------------------------------------------------------------------------
+    bool isDone() const { return isDone(getLock()); }
+    bool empty()  const { return empty(getLock()); }
+    size_t size() const { return size(getLock()); }
+
+    size_t getItemCount() const { return getItemCount(getLock()); }
+    size_t getDroppedItemCount() const { return getDroppedItemCount(getLock()); }
+    size_t getSpilledSize() const { return getSpilledSize(getLock()); }
+    size_t getSpilledItemCount() const { return getSpilledItemCount(getLock()); }
+    size_t getSegmentCount() const { return getSegmentCount(getLock()); }
+    size_t getLiveSegmentCount() const { return getLiveSegmentCount(getLock()); }
+};
+
+//******************************************************************************
+/**
+ * the reading end of a spilling queue
+ * When the last writer is destroyed, all pop's return with State::empty
+ * (after the remaining values)
+ */
+template<typename T, typename SERIALIZER = SpillSerializer<T> >
+using SpillingQueue = asynchronous::Reader< asynchronous::basic_spilling_queue<T, SERIALIZER> >;
+
+template<typename T, typename SERIALIZER = SpillSerializer<T> >
+using SharedSpillingQueue = asynchronous::Writer< asynchronous::basic_spilling_queue<T, SERIALIZER> >;
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
@@ -23,10 +23,16 @@
 #pragma once
 
 //******************************************************************************
+#include "asynchronous/executor.hpp"
 #include "asynchronous/futurevalue.hpp"
+#include "asynchronous/partition.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <future>
+#include <memory>
+#include <tuple>
 #include <vector>
 #include <mutex>
 
@@ -37,52 +43,34 @@ namespace asynchronous {
 namespace details {
 //******************************************************************************
 
+template<typename VOID, typename FUNC, typename... ARGS>
+struct result_base
+{};
+
 template<typename FUNC, typename... ARGS>
-struct result_t
+struct result_base< std::void_t< typename std::result_of< FUNC(ARGS...) >::type >, FUNC, ARGS...>
 {
     using type = typename std::result_of< FUNC(ARGS...) >::type;
     using future = typename std::future<type>;
     using container = typename std::vector<future>;
 };
 
-//------------------------------------------------------------------------------
 /**
- * this class can be used to walk thread-safe through an iterator range
+ * NOTE: if FUNC can not be called with ARGS, there are no members,
+ *       so overloads using them are not considered (SFINAE)
  */
-template<typename ITERATOR>
-class IteratorWalker
-{
-public:
-    using iterator = ITERATOR;
-    using pointer =  typename std::iterator_traits<iterator>::pointer;
-    using mutex_t = std::mutex;
-    using lock_t = std::unique_lock<mutex_t>;
-
-private:
-    iterator ivPos;
-    iterator ivEnd;
-    mutex_t  ivMutex;
-
-    lock_t getLock() { return lock_t(ivMutex); }
-
-public:
-    explicit IteratorWalker(iterator begin, iterator end) :
-            ivPos(std::move(begin)),
-            ivEnd(std::move(end))
-    {}
-
-    pointer getNext()
-    {
-        auto lck = getLock();
-
-        if (ivPos == ivEnd) { return nullptr; }
+template<typename FUNC, typename... ARGS>
+struct result_t : public result_base<void, FUNC, ARGS...>
+{};
 
-        auto result = &(*ivPos);
-        ++ivPos;
-        return result;
-    }
-};
+/**
+ * the result of the function, if it is called like std::async or std::thread do
+ * with copies of func and args as rvalues
+ */
+template<typename FUNC, typename... ARGS>
+using async_result_t = result_t< std::decay_t<FUNC>, std::decay_t<ARGS>... >;
 
+//------------------------------------------------------------------------------
 /**
  * @brief Functor to work on each iteration
  * @tparam ITERATOR
@@ -90,7 +78,7 @@ public:
 template<typename ITERATOR>
 struct Walker
 {
-    using iterator = IteratorWalker<ITERATOR>;
+    using iterator = PartitionWalker<ITERATOR>;
 
     /**
      * @brief iterate over walker and call func with args on each iteration
@@ -101,8 +89,11 @@ struct Walker
     template<typename FUNC, typename... ARGS>
     void operator () (iterator& walker, FUNC&& func, ARGS&&... args) const
     {
-        while(auto* e = walker.getNext())
-        { std::invoke(func, args..., *e); }
+        walker.walk([&](const typename iterator::Range& range)
+        {
+            for(auto pos = range.first; pos != range.last; ++pos)
+            { std::invoke(func, args..., *pos); }
+        });
     }
 };
 
@@ -114,6 +105,113 @@ inline size_t getSize(const CONTAINER& container)
     return static_cast<size_t>( std::distance(begin(container), end(container)) );
 }
 
+/**
+ * split size elements into blockCount blocks of (almost) equal size
+ * @param size number of elements
+ * @param blockCount number of blocks, has to be greater than 0
+ * @return the blockCount+1 boundaries of the blocks, block i is [result[i], result[i+1])
+ */
+inline std::vector<size_t> getBlockBounds(size_t size, size_t blockCount)
+{
+    std::vector<size_t> bounds(blockCount + 1);
+    for(size_t i = 0; i <= blockCount; ++i)
+    { bounds[i] = (size / blockCount) * i + (size % blockCount) * i / blockCount; }
+    return bounds;
+}
+
+/**
+ * @return the iterator pos moved forward by index elements
+ */
+template<typename ITERATOR>
+inline ITERATOR getIterator(ITERATOR pos, size_t index)
+{
+    using diff_t = typename std::iterator_traits<ITERATOR>::difference_type;
+    return pos + static_cast<diff_t>(index);
+}
+
+//------------------------------------------------------------------------------
+/**
+ * @brief hand the invocation of func over to the executor
+ *        NOTE: like std::async, func and args are copied (or moved)
+ *              and invoked as rvalues
+ * @return future to the result of func
+ */
+template <typename EXECUTOR, typename FUNC, typename... ARGS,
+          typename RESULT = async_result_t<FUNC, ARGS...> >
+inline typename RESULT::future executeAsync(EXECUTOR& executor, FUNC&& func, ARGS&&... args)
+{
+    using task_t = std::packaged_task< typename RESULT::type() >;
+
+    // the executor may copy the job, so the task has to be shared
+    auto task = std::make_shared<task_t>(
+            [func = std::forward<FUNC>(func),
+             params = std::make_tuple(std::forward<ARGS>(args)...)] () mutable
+            { return std::apply(std::move(func), std::move(params)); });
+
+    auto future = task->get_future();
+    executor.execute( [task] () { (*task)(); } );
+    return future;
+}
+
+/**
+ * @brief the futures of all jobs handed over to an executor
+ *        the destructor waits for all of them
+ * @tparam EXECUTOR either a reference to or a copy of the executor
+ * @tparam T the result type of the jobs
+ */
+template<typename EXECUTOR, typename T = void>
+struct ExecutorJobs : public std::vector< std::future<T> >
+{
+    EXECUTOR ivExecutor;
+
+    explicit ExecutorJobs(EXECUTOR&& executor) :
+            std::vector< std::future<T> >(),
+            ivExecutor(std::forward<EXECUTOR>(executor))
+    {}
+
+    ExecutorJobs(ExecutorJobs&&) = default;
+
+    ~ExecutorJobs()
+    {
+        for(auto& job : *this)
+        {
+            if (job.valid()) { asynchronous::wait(ivExecutor, job); }
+        }
+    }
+
+    template<typename FUNC, typename... ARGS>
+    void start(FUNC&& func, ARGS&&... args)
+    { this->emplace_back( executeAsync(ivExecutor, std::forward<FUNC>(func), std::forward<ARGS>(args)...) ); }
+};
+
+/**
+ * @brief own threads, which are joined in the destructor
+ */
+struct JoiningThreads : public std::vector< std::thread >
+{
+    JoiningThreads() = default;
+    JoiningThreads(JoiningThreads&&) = default;
+
+    ~JoiningThreads()
+    {
+        for(auto& thread : *this)
+        { thread.join(); }
+    }
+
+    template<typename FUNC, typename... ARGS>
+    void start(FUNC&& func, ARGS&&... args)
+    { this->emplace_back( std::forward<FUNC>(func), std::forward<ARGS>(args)...); }
+};
+
+/**
+ * @brief the workers of a container walk,
+ *        either own threads or jobs run by the EXECUTOR
+ */
+template<typename EXECUTOR>
+using Workers = std::conditional_t< std::is_void_v<EXECUTOR>,
+                                    JoiningThreads,
+                                    ExecutorJobs<EXECUTOR> >;
+
 //------------------------------------------------------------------------------
 /**
  * @brief This class is basically a threadpool working on a container
@@ -121,39 +219,19 @@ inline size_t getSize(const CONTAINER& container)
  *        in threadCount threads
  * @tparam RESULT the return type of the function
  * @tparam CONTAINER container type
+ * @tparam EXECUTOR void to start own threads, otherwise the executor (reference) to run on
  */
-template<typename RESULT, typename CONTAINER>
+template<typename RESULT, typename CONTAINER, typename EXECUTOR = void>
 class ValueThreads
 {
 private:
     using values_t = CONTAINER;
-    using value_iterator = decltype( std::begin( std::declval<values_t>() ));
+    using value_iterator = decltype( std::begin( std::declval<values_t&>() ));
+    using walker_t = PartitionWalker<value_iterator>;
+    using range_t = typename walker_t::Range;
 
     using result_t = std::decay_t<RESULT>;
     using results_t = std::vector< asynchronous::FutureValue<result_t> >;
-    using result_iterator = typename results_t::iterator;
-
-    struct Iterators
-    {
-        value_iterator  ivValueIterator;
-        value_iterator  ivValueEnd;
-        result_iterator ivResultIterator;
-
-        explicit Iterators(values_t values,
-                           results_t& results) :
-            ivValueIterator( std::begin(values) ),
-            ivValueEnd( std::end(values) ),
-            ivResultIterator( std::begin(results) )
-        { }
-
-        bool next()
-        {
-            if (ivValueIterator == ivValueEnd) { return false; }
-            ++ivValueIterator;
-            ++ivResultIterator;
-            return true;
-        }
-    };
 
     static size_t getSize(size_t threadCount, const values_t& values)
     {
@@ -161,25 +239,22 @@ private:
         return details::getSize(values);
     }
 
+    /**
+     * NOTE: if the container was handed over as an rvalue,
+     *       it is kept here, so the iterators stay valid
+     */
     struct SharedData
     {
-        std::mutex  ivMutex;
+        values_t    ivValues;
         results_t   ivResults;
-        Iterators   ivIterators;
+        walker_t    ivWalker;
 
-        explicit SharedData(size_t threadCount, values_t values) :
-                ivMutex(),
-                ivResults(getSize(threadCount, values) ),
-                ivIterators(values, ivResults)
+        explicit SharedData(size_t threadCount, values_t&& values, const Partition& partition) :
+                ivValues(std::forward<values_t>(values)),
+                ivResults(getSize(threadCount, ivValues) ),
+                ivWalker(std::begin(ivValues), ivResults.size(),
+                         std::min(threadCount, ivResults.size()), partition)
         {}
-
-        bool getIterators(value_iterator &valueIterator, result_iterator &resultIterator)
-        {
-            std::unique_lock lock{ivMutex};
-            valueIterator = ivIterators.ivValueIterator;
-            resultIterator = ivIterators.ivResultIterator;
-            return ivIterators.next();
-        };
     };
 
     /**
@@ -193,35 +268,28 @@ private:
     template<typename FUNC, typename ... ARGS>
     static void run(SharedData& sharedData, FUNC&& func, ARGS&&... args)
     {
-        value_iterator valueIterator;
-        result_iterator resultIterator;
-
-        while(sharedData.getIterators(valueIterator, resultIterator))
+        sharedData.ivWalker.walk([&](const range_t& range)
         {
-            try
+            auto resultIterator = getIterator(std::begin(sharedData.ivResults), range.offset);
+
+            for(auto valueIterator = range.first; valueIterator != range.last; ++valueIterator, ++resultIterator)
             {
-                if constexpr( std::is_void_v<RESULT> )
+                try
                 {
-                    std::invoke(func, *valueIterator, args...);
-                    resultIterator->set_value( );
+                    if constexpr( std::is_void_v<RESULT> )
+                    {
+                        std::invoke(func, *valueIterator, args...);
+                        resultIterator->set_value( );
+                    }
+                    else
+                    { resultIterator->set_value( std::invoke(func, *valueIterator, args...) ); }
                 }
-                else
-                { resultIterator->set_value( std::invoke(func, *valueIterator, args...) ); }
+                catch(...)
+                { resultIterator->set_exception( std::current_exception()); }
             }
-            catch(...)
-            { resultIterator->set_exception( std::current_exception()); }
-        }
+        });
     }
 
-    struct Threads : public std::vector< std::thread>
-    {
-         ~Threads()
-         {
-             for(auto& thread : *this)
-             { thread.join(); }
-         }
-    };
-
     /**
      * @brief having the SharedData in a unique Ptr makes this whole struct
      *        not copy-able but movable
@@ -230,37 +298,68 @@ private:
      *        NOTE: The threads will join, before the ivShared is destroyed!
      */
     std::unique_ptr<SharedData> ivSharedDataPtr;
-    Threads ivThreads;
+    Workers<EXECUTOR> ivThreads;
 
-public:
     /**
-     * @brief initialize all threads to set the results
-     *        with calling func on each element in values
-     * @param threadCount number of threads to run on
-     * @param values any container that supports std::begin, end and the member function size
-     * @param func to be call on every element in values
-     * @param args extra parameters to func
+     * @brief start at most threadCount workers, but not more than elements
      */
     template<typename FUNC, typename ... ARGS>
-    explicit ValueThreads(size_t threadCount, values_t values, FUNC&& func, ARGS&&... args) :
-            ivSharedDataPtr( new SharedData{threadCount, values} ),
-            ivThreads()
+    void startWorkers(size_t threadCount, FUNC&& func, ARGS&&... args)
     {
-        threadCount = std::min(threadCount, details::getSize(values));
+        threadCount = std::min(threadCount, size());
         ivThreads.reserve( threadCount );
         for(size_t i = 0; i < threadCount; ++i)
         {
             try
             {
-                ivThreads.emplace_back(&ValueThreads::run<FUNC, ARGS...>,
-                                     std::ref(*ivSharedDataPtr),
-                                     func,
-                                     std::forward<ARGS>(args)...);
+                ivThreads.start(&ValueThreads::run<FUNC, ARGS...>,
+                                std::ref(*ivSharedDataPtr),
+                                func,
+                                args...);
             } catch(std::system_error&)
             { /*ignore if we can not start the thread*/}
         }
     }
 
+public:
+    /**
+     * @brief initialize all threads to set the results
+     *        with calling func on each element in values
+     * @param threadCount number of threads to run on
+     * @param values any container that supports std::begin, end and the member function size
+     * @param partition how the elements are handed out to the threads
+     * @param func to be call on every element in values
+     * @param args extra parameters to func
+     */
+    template<typename FUNC, typename ... ARGS>
+    explicit ValueThreads(size_t threadCount, values_t&& values, const Partition& partition,
+                          FUNC&& func, ARGS&&... args) :
+            ivSharedDataPtr( new SharedData{threadCount, std::forward<values_t>(values), partition} ),
+            ivThreads()
+    {
+        startWorkers(threadCount, std::forward<FUNC>(func), std::forward<ARGS>(args)...);
+    }
+
+    /**
+     * @brief same as above, but the workers are jobs run by the executor
+     *        NOTE: the executor has to outlive this object, if it was
+     *              handed over as an lvalue
+     * @param executor to run the workers on
+     * @param threadCount number of jobs to hand over to the executor
+     * @param values any container that supports std::begin, end and the member function size
+     * @param partition how the elements are handed out to the jobs
+     * @param func to be call on every element in values
+     * @param args extra parameters to func
+     */
+    template<typename EXEC, typename FUNC, typename ... ARGS>
+    explicit ValueThreads(EXEC&& executor, size_t threadCount, values_t&& values,
+                          const Partition& partition, FUNC&& func, ARGS&&... args) :
+            ivSharedDataPtr( new SharedData{threadCount, std::forward<values_t>(values), partition} ),
+            ivThreads( std::forward<EXEC>(executor) )
+    {
+        startWorkers(threadCount, std::forward<FUNC>(func), std::forward<ARGS>(args)...);
+    }
+
     auto begin() const { return std::begin(ivSharedDataPtr->ivResults); }
     auto end() const { return std::end(ivSharedDataPtr->ivResults); }
 
@@ -298,6 +397,24 @@ inline typename RESULT::future invoke_async(FUNC T::* memfunc, T* obj_ptr, ARGS&
     return asynchronous::invoke_async(std::mem_fn(memfunc), obj_ptr, std::forward< ARGS >(args)...);
 }
 
+/**
+ * hand the invocation of func over to the executor
+ * and return a future to its result.
+ * NOTE: unlike the future of std::async, the destructor of
+ *       this future does not wait for func to return
+ * @param executor any executor (see executor.hpp)
+ * @param func callable
+ * @param args parameters
+ * @return future to the result of func
+ */
+template <typename EXECUTOR, typename FUNC, typename... ARGS,
+          typename = enable_if_executor_t<EXECUTOR>,
+          typename RESULT = details::async_result_t<FUNC, ARGS...> >
+inline typename RESULT::future invoke_async(EXECUTOR&& executor, FUNC&& func, ARGS&&... args)
+{
+    return details::executeAsync(executor, std::forward<FUNC>(func), std::forward<ARGS>(args)...);
+}
+
 /**
  * start threadCount threads and invoke func in each of them
  * and return a vector of futures for all results
@@ -317,6 +434,31 @@ inline typename RESULT::container invoke_threads(size_t threadCount, FUNC&& func
     return result;
 }
 
+/**
+ * hand func threadCount times over to the executor
+ * and return a vector of futures for all results
+ * NOTE: unlike the futures of std::async, the destructors of
+ *       these futures do not wait for func to return
+ * @param executor any executor (see executor.hpp)
+ * @param threadCount
+ * @param func
+ * @return vector of future to the results
+ */
+template<typename EXECUTOR, typename FUNC, typename... ARGS,
+         typename = enable_if_executor_t<EXECUTOR>,
+         typename RESULT = details::async_result_t<FUNC, ARGS...> >
+inline typename RESULT::container invoke_threads(EXECUTOR&& executor, size_t threadCount,
+                                                 FUNC&& func, ARGS&&... args)
+{
+    typename RESULT::container result;
+    result.reserve(threadCount);
+
+    for(size_t i = 0; i < threadCount; ++i)
+    { result.emplace_back( details::executeAsync(executor, func, args...) ); }
+
+    return result;
+}
+
 /**
  * run the function in threadCount threads and return after all have returned
  * if threadCount is zero it returns immediately
@@ -339,21 +481,57 @@ inline void run_threads(size_t threadCount, FUNC&& func, ARGS&&... args)
     // the destructors of all futures in "threads" wait for their threads to join
 }
 
+/**
+ * run the function in threadCount workers, where threadCount-1 workers
+ * are handed over to the executor and the calling thread is the last one,
+ * and return after all have returned.
+ * While waiting the calling thread helps the executor, if it supports it
+ * (see asynchronous::wait)
+ * NOTE: "func" should not throw, for the same reasons as above
+ * @param executor any executor (see executor.hpp)
+ * @param threadCount number of workers to use (incl. the calling thread)
+ * @param func
+ * @param args
+ */
+template<typename EXECUTOR, typename FUNC, typename... ARGS,
+         typename = enable_if_executor_t<EXECUTOR> >
+inline void run_threads(EXECUTOR&& executor, size_t threadCount, FUNC&& func, ARGS&&... args)
+{
+    if (threadCount == 0) { return; }
+
+    using RESULT = typename details::async_result_t<FUNC, ARGS...>::type;
+    details::ExecutorJobs<EXECUTOR&, RESULT> jobs(executor);
+    jobs.reserve(threadCount-1);
+
+    for(size_t i = 1; i < threadCount; ++i)
+    { jobs.emplace_back( details::executeAsync(executor, func, args...) ); }
+
+    std::invoke( std::forward<FUNC>(func), std::forward<ARGS>(args)...);
+
+    // the destructor of "jobs" waits for all jobs to return
+}
+
 //------------------------------------------------------------------------------
 
 /**
  * call func for each element in the container in threadCount threads
  * NOTE: func should not throw, for the same reasons as in "run_threads"
  * @param threadCount number of threads to use (incl. the calling thread)
+ * @param partition how the elements are handed out to the threads
  * @param container holding the elements
  * @param func will be called as func(args..., element&)
  * @param args function parameter preceding the element
  */
-template<typename CONTAINER , typename FUNC, typename... ARGS>
-inline void for_each(size_t threadCount, CONTAINER&& container, FUNC&& func, ARGS&&... args)
+template<typename CONTAINER , typename FUNC, typename... ARGS,
+        typename = decltype( std::begin( std::declval<CONTAINER>()) ) >
+inline void for_each(size_t threadCount, const Partition& partition,
+                     CONTAINER&& container, FUNC&& func, ARGS&&... args)
 {
     using ITERATOR = decltype( std::begin(container) );
-    details::IteratorWalker<ITERATOR> iter(std::begin(container), std::end(container));
+
+    threadCount = std::min(threadCount, details::getSize(container));
+    details::PartitionWalker<ITERATOR> iter(std::begin(container), details::getSize(container),
+                                            threadCount, partition);
 
     run_threads(threadCount,
                 details::Walker<ITERATOR>{},
@@ -362,6 +540,101 @@ inline void for_each(size_t threadCount, CONTAINER&& container, FUNC&& func, ARG
                 std::forward<ARGS>(args)...);
 }
 
+/**
+ * call func for each element in the container in threadCount threads
+ * the partition is chosen automatically from the number of elements
+ * NOTE: func should not throw, for the same reasons as in "run_threads"
+ * @param threadCount number of threads to use (incl. the calling thread)
+ * @param container holding the elements
+ * @param func will be called as func(args..., element&)
+ * @param args function parameter preceding the element
+ */
+template<typename CONTAINER , typename FUNC, typename... ARGS,
+        typename = decltype( std::begin( std::declval<CONTAINER>()) ) >
+inline void for_each(size_t threadCount, CONTAINER&& container, FUNC&& func, ARGS&&... args)
+{
+    asynchronous::for_each(threadCount,
+                           Partition{},
+                           std::forward<CONTAINER>(container),
+                           std::forward<FUNC>(func),
+                           std::forward<ARGS>(args)...);
+}
+
+/**
+ * call func for each index in [0, count) in at most threadCount threads
+ * the indices are handed out in ascending order
+ * NOTE: func should not throw, for the same reasons as in "run_threads"
+ * @param threadCount number of threads to use (incl. the calling thread)
+ * @param count number of indices
+ * @param func will be called as func(args..., index)
+ * @param args function parameter preceding the index
+ */
+template<typename FUNC, typename... ARGS>
+inline void for_each_index(size_t threadCount, size_t count, FUNC&& func, ARGS&&... args)
+{
+    std::atomic_size_t next{0};
+
+    run_threads(std::min(threadCount, count),
+                [&next, count, &func, &args...]()
+                {
+                    for(auto index = next++; index < count; index = next++)
+                    { std::invoke(func, args..., index); }
+                });
+}
+
+/**
+ * call func for each element in the container with threadCount workers
+ * run on the executor, see run_threads
+ * NOTE: func should not throw, for the same reasons as in "run_threads"
+ * @param executor any executor (see executor.hpp)
+ * @param threadCount number of workers to use (incl. the calling thread)
+ * @param partition how the elements are handed out to the workers
+ * @param container holding the elements
+ * @param func will be called as func(args..., element&)
+ * @param args function parameter preceding the element
+ */
+template<typename EXECUTOR, typename CONTAINER , typename FUNC, typename... ARGS,
+        typename = enable_if_executor_t<EXECUTOR>,
+        typename = decltype( std::begin( std::declval<CONTAINER>()) ) >
+inline void for_each(EXECUTOR&& executor, size_t threadCount, const Partition& partition,
+                     CONTAINER&& container, FUNC&& func, ARGS&&... args)
+{
+    using ITERATOR = decltype( std::begin(container) );
+
+    threadCount = std::min(threadCount, details::getSize(container));
+    details::PartitionWalker<ITERATOR> iter(std::begin(container), details::getSize(container),
+                                            threadCount, partition);
+
+    run_threads(executor,
+                threadCount,
+                details::Walker<ITERATOR>{},
+                std::ref(iter),
+                std::forward<FUNC>(func),
+                std::forward<ARGS>(args)...);
+}
+
+/**
+ * see above, the partition is chosen automatically from the number of elements
+ * @param executor any executor (see executor.hpp)
+ * @param threadCount number of workers to use (incl. the calling thread)
+ * @param container holding the elements
+ * @param func will be called as func(args..., element&)
+ * @param args function parameter preceding the element
+ */
+template<typename EXECUTOR, typename CONTAINER , typename FUNC, typename... ARGS,
+        typename = enable_if_executor_t<EXECUTOR>,
+        typename = decltype( std::begin( std::declval<CONTAINER>()) ) >
+inline void for_each(EXECUTOR&& executor, size_t threadCount,
+                     CONTAINER&& container, FUNC&& func, ARGS&&... args)
+{
+    asynchronous::for_each(executor,
+                           threadCount,
+                           Partition{},
+                           std::forward<CONTAINER>(container),
+                           std::forward<FUNC>(func),
+                           std::forward<ARGS>(args)...);
+}
+
 //------------------------------------------------------------------------------
 /**
  * @brief invokes the callable func on each element in container
@@ -396,6 +669,7 @@ inline void for_each(size_t threadCount, CONTAINER&& container, FUNC&& func, ARG
  *
  * @param threadCount number of threads to be used
  *        NOTE: using 0 threads will not invoke the func at all
+ * @param partition how the elements are handed out to the threads
  * @param container any container supporting std::begin/end
  * @param func will be invoked on each element in the container, like
  *        result = func(element, args...);
@@ -404,7 +678,8 @@ inline void for_each(size_t threadCount, CONTAINER&& container, FUNC&& func, ARG
  */
 template<typename CONTAINER , typename FUNC, typename... ARGS,
         typename VALUEITERATOR = decltype( std::begin( std::declval<CONTAINER>()) ) >
-inline auto invoke_on_each(size_t threadCount, CONTAINER&& container, FUNC&& func, ARGS&&... args)
+inline auto invoke_on_each(size_t threadCount, const Partition& partition,
+                           CONTAINER&& container, FUNC&& func, ARGS&&... args)
 {
     using VALUE = decltype( *(std::declval<VALUEITERATOR>()) );
     using FUNC_RESULT = typename details::result_t<FUNC, VALUE, ARGS...>::type;
@@ -412,10 +687,87 @@ inline auto invoke_on_each(size_t threadCount, CONTAINER&& container, FUNC&& fun
 
     return VTHREADS {threadCount,
                      std::forward<CONTAINER>(container),
+                     partition,
                      std::forward<FUNC>(func),
                      std::forward<ARGS>(args)...};
 }
 
+/**
+ * @brief see above, the partition is chosen automatically from the number of elements
+ * @param threadCount number of threads to be used
+ *        NOTE: using 0 threads will not invoke the func at all
+ * @param container any container supporting std::begin/end
+ * @param func will be invoked on each element in the container, like
+ *        result = func(element, args...);
+ * @param args extra parameters to the func
+ * @return an object representing all results
+ */
+template<typename CONTAINER , typename FUNC, typename... ARGS,
+        typename = decltype( std::begin( std::declval<CONTAINER>()) ) >
+inline auto invoke_on_each(size_t threadCount, CONTAINER&& container, FUNC&& func, ARGS&&... args)
+{
+    return invoke_on_each(threadCount,
+                          Partition{},
+                          std::forward<CONTAINER>(container),
+                          std::forward<FUNC>(func),
+                          std::forward<ARGS>(args)...);
+}
+
+/**
+ * @brief see above, but the work is done by threadCount jobs run on the executor
+ *        NOTE: if the executor is handed over as an lvalue,
+ *              it has to outlive the returned object
+ * @param executor any executor (see executor.hpp)
+ * @param threadCount number of jobs to be used
+ *        NOTE: using 0 jobs will not invoke the func at all
+ * @param partition how the elements are handed out to the jobs
+ * @param container any container supporting std::begin/end
+ * @param func will be invoked on each element in the container, like
+ *        result = func(element, args...);
+ * @param args extra parameters to the func
+ * @return an object representing all results
+ */
+template<typename EXECUTOR, typename CONTAINER , typename FUNC, typename... ARGS,
+        typename = enable_if_executor_t<EXECUTOR>,
+        typename VALUEITERATOR = decltype( std::begin( std::declval<CONTAINER>()) ) >
+inline auto invoke_on_each(EXECUTOR&& executor, size_t threadCount, const Partition& partition,
+                           CONTAINER&& container, FUNC&& func, ARGS&&... args)
+{
+    using VALUE = decltype( *(std::declval<VALUEITERATOR>()) );
+    using FUNC_RESULT = typename details::result_t<FUNC, VALUE, ARGS...>::type;
+    using VTHREADS = details::ValueThreads<FUNC_RESULT, CONTAINER, EXECUTOR>;
+
+    return VTHREADS {std::forward<EXECUTOR>(executor),
+                     threadCount,
+                     std::forward<CONTAINER>(container),
+                     partition,
+                     std::forward<FUNC>(func),
+                     std::forward<ARGS>(args)...};
+}
+
+/**
+ * @brief see above, the partition is chosen automatically from the number of elements
+ * @param executor any executor (see executor.hpp)
+ * @param threadCount number of jobs to be used
+ * @param container any container supporting std::begin/end
+ * @param func will be invoked on each element in the container
+ * @param args extra parameters to the func
+ * @return an object representing all results
+ */
+template<typename EXECUTOR, typename CONTAINER , typename FUNC, typename... ARGS,
+        typename = enable_if_executor_t<EXECUTOR>,
+        typename = decltype( std::begin( std::declval<CONTAINER>()) ) >
+inline auto invoke_on_each(EXECUTOR&& executor, size_t threadCount,
+                           CONTAINER&& container, FUNC&& func, ARGS&&... args)
+{
+    return invoke_on_each(std::forward<EXECUTOR>(executor),
+                          threadCount,
+                          Partition{},
+                          std::forward<CONTAINER>(container),
+                          std::forward<FUNC>(func),
+                          std::forward<ARGS>(args)...);
+}
+
 /**
  * @brief invokes the callable func on each element in the container in
  *        at most number of elements count of threads
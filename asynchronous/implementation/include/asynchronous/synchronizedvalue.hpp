@@ -16,29 +16,108 @@
 #pragma once
 
 //******************************************************************************
+#include "asynchronous/lock_profile.hpp"
+#include "asynchronous/seqlock.hpp"
+#include "asynchronous/lightweight/shared_mutex.hpp"
+
 #include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <type_traits>
 
 //******************************************************************************
 namespace asynchronous {
 //******************************************************************************
+/**
+ * The lock policies for SynchronizedValue:
+ * the guard_t is used by the (non const) Updater to modify the value,
+ * the shared_guard_t by the ConstUpdater to only read it.
+ */
+
+/**
+ * the default: an exclusive mutex for the readers and the writers
+ */
+struct ExclusiveLock
+{
+    using mutex_t = std::mutex;
+    using guard_t = std::unique_lock<mutex_t>;
+    using shared_guard_t = guard_t;
+};
+
+/**
+ * a std::shared_mutex: the readers share the lock
+ */
+struct SharedLock
+{
+    using mutex_t = std::shared_mutex;
+    using guard_t = std::unique_lock<mutex_t>;
+    using shared_guard_t = std::shared_lock<mutex_t>;
+};
+
+/**
+ * the readers share the lock, but a waiting writer blocks new readers,
+ * so the writers are not starved by a steady stream of readers
+ */
+struct WriterPreferringLock
+{
+    using mutex_t = lightweight::WriterPreferringMutex;
+    using guard_t = std::unique_lock<mutex_t>;
+    using shared_guard_t = std::shared_lock<mutex_t>;
+};
+
+namespace details {
+//******************************************************************************
+/**
+ * the lock policy BASE with a ProfiledMutex
+ */
+template<typename BASE>
+struct ProfiledLock
+{
+    using mutex_t = ProfiledMutex<typename BASE::mutex_t>;
+    using guard_t = std::unique_lock<mutex_t>;
+    using shared_guard_t = std::conditional_t<
+            std::is_same<typename BASE::guard_t, typename BASE::shared_guard_t>::value,
+            guard_t,
+            std::shared_lock<mutex_t> >;
+};
+
+//******************************************************************************
+}  // namespace details
+
+/**
+ * the lock policy BASE, profiled if ASYNCHRONOUS_LOCK_PROFILING is defined (project wide)
+ * (see LockProfileRegistry), and just BASE otherwise
+ */
+#if defined(ASYNCHRONOUS_LOCK_PROFILING)
+template<typename BASE = ExclusiveLock>
+using ProfiledLock = details::ProfiledLock<BASE>;
+#else
+template<typename BASE = ExclusiveLock>
+using ProfiledLock = BASE;
+#endif
+
+//------------------------------------------------------------------------------
 /**
  * Provide a "guard" object, that holds the lock while existing
  * Through this guard one can access the value in the "usual" way
  * it helps to see this as a "pointer" to value
  */
-template<typename ValueType>
+template<typename ValueType, typename READ = LockedRead,
+         typename GUARD = ExclusiveLock::guard_t>
 class Updater
 {
 public:
     using value_t = ValueType;
-    using mutex_t = std::mutex;
-    using guard_t = std::unique_lock<mutex_t>;   // lock is movable, guard is not
+    using guard_t = GUARD;      // lock is movable, guard is not
+    using mutex_t = typename guard_t::mutex_type;
+    using read_t  = READ;
 
 private:
     guard_t     ivLock;
     value_t*    ivValuePtr;
+    read_t*     ivRead;     // the read path to tell about the write (if any)
 
-    template<typename T>
+    template<typename T, typename R, typename L>
     friend class SynchronizedValue;
 
     /**
@@ -46,31 +125,44 @@ private:
      * but create it only by this SynchronizedValue
      * @param MutexRef the mutex to be locked while we exist
      * @param ValuePtr the value we want to grant access to
+     * @param Read the read path, that is told about the write while we exist
      */
-    Updater(mutex_t& MutexRef, value_t* ValuePtr) :
+    Updater(mutex_t& MutexRef, value_t* ValuePtr, read_t* Read = nullptr) :
         ivLock(MutexRef),
-        ivValuePtr(ValuePtr)
-    {}
+        ivValuePtr(ValuePtr),
+        ivRead(Read)
+    {
+        if (ivRead) { ivRead->beginWrite(); }
+    }
 
 public:
-    ~Updater() = default;
+    ~Updater()
+    {
+        if (ivRead) { ivRead->endWrite(); }
+    }
+
     Updater(const Updater& other) = delete;
     Updater& operator = (const Updater& other) = delete;
 
     Updater(Updater&& other) :
         ivLock(std::move(other.ivLock)),
-        ivValuePtr(other.ivValuePtr)
+        ivValuePtr(other.ivValuePtr),
+        ivRead(other.ivRead)
     {
         other.ivValuePtr = NULL;
+        other.ivRead = nullptr;
     }
 
     Updater& operator = (Updater&& other)
     {
         if (&other != this)
         {
+            if (ivRead) { ivRead->endWrite(); }
             ivLock = std::move(other.ivLock);
             ivValuePtr = other.ivValuePtr;
+            ivRead = other.ivRead;
             other.ivValuePtr = NULL;
+            other.ivRead = nullptr;
         }
         return *this;
     }
@@ -116,19 +208,28 @@ public:
 //------------------------------------------------------------------------------
 /**
  * This class provides a simple to use thread-safe access to a value
+ * With READ = SeqLockRead, getValue does not take the lock
+ * (for trivially copyable values only).
+ * With LOCK = SharedLock or WriterPreferringLock, the const access
+ * (ConstUpdate_t) takes a shared lock, so readers do not serialize.
+ * With LOCK = ProfiledLock<...>, the contention of the lock is recorded,
+ * the long holds with the call site of getUpdater.
  */
-template<typename ValueType>
+template<typename ValueType, typename READ = LockedRead, typename LOCK = ExclusiveLock>
 class SynchronizedValue
 {
 public:
-    using Update_t = Updater<ValueType>;
-    using ConstUpdate_t = Updater< const ValueType>;
+    using lock_policy_t = LOCK;
+    using Update_t = Updater<ValueType, READ, typename lock_policy_t::guard_t>;
+    using ConstUpdate_t = Updater< const ValueType, LockedRead, typename lock_policy_t::shared_guard_t>;
     using value_t  = typename Update_t::value_t;
     using mutex_t  = typename Update_t::mutex_t;
+    using read_t   = READ;
 
 private:
     value_t         ivValue;
     mutable mutex_t ivMutex;
+    read_t          ivRead;
 
 public:
     /**
@@ -146,24 +247,51 @@ public:
 
     /**
      * Create an update object that holds the lock while existing.
+     * @param site where the lock is taken, for the lock profile (see ProfiledLock)
      * @return an guarding object providing synchronized access to the value
      */
-    Update_t getUpdater() { return Update_t(ivMutex, &ivValue); }
-    ConstUpdate_t getUpdater() const { return ConstUpdate_t(ivMutex, &ivValue); }
+    Update_t getUpdater(const LockSite& site = LockSite::current())
+    {
+        details::setLockSite(ivMutex, site);
+        return Update_t(ivMutex, &ivValue, &ivRead);
+    }
+
+    ConstUpdate_t getUpdater(const LockSite& site = LockSite::current()) const
+    {
+        details::setLockSite(ivMutex, site);
+        return ConstUpdate_t(ivMutex, &ivValue);
+    }
 
     /**
      * dereference operator to return a guarding updater object
      * @return an guarding object providing synchronized access to the value
      */
-    Update_t operator* () { return Update_t(ivMutex, &ivValue); }
+    Update_t operator* () { return getUpdater(); }
     ConstUpdate_t operator* () const { return ConstUpdate_t(ivMutex, &ivValue); }
 
     /**
      * access operator to return a guarding updater object
      * @return an guarding object providing synchronized access to the value
      */
-    Update_t operator -> () { return Update_t(ivMutex, &ivValue); }
+    Update_t operator -> () { return getUpdater(); }
     ConstUpdate_t operator -> () const { return ConstUpdate_t(ivMutex, &ivValue); }
+
+    /**
+     * @return a copy of the current value
+     *         with SeqLockRead without taking the lock
+     */
+    value_t getValue() const
+    {
+        if constexpr (read_t::lockFree) { return ivRead.read(ivValue); }
+        else { return *getUpdater(); }
+    }
+
+    /**
+     * name this value in the LockProfileRegistry
+     * does nothing, if the lock is not profiled
+     * @param name the name to report
+     */
+    void setProfileName(std::string name) { details::setProfileName(ivMutex, std::move(name)); }
 };
 
 //******************************************************************************
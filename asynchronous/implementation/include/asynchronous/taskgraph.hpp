@@ -0,0 +1,243 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/executor.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+/**
+ * a directed acyclic graph of tasks:
+ * run(executor) hands every task to the executor as soon as
+ * its last predecessor finished (atomic in-degree counters),
+ * so there are no idle waves like with latches or run_tasks rounds.
+ * The thread finishing a task runs one of the released successors itself,
+ * the others go to the executor.
+ *
+ * Every run records when and in which thread each task ran,
+ * see getTimings, getCriticalPath and writeTimings.
+ *
+ * @example:
+ *     asynchronous::TaskGraph graph;
+ *     auto load = graph.add([]{ ... }, "load");
+ *     auto parse = graph.add([]{ ... }, "parse");
+ *     graph.precede(load, parse);
+ *     asynchronous::WorkStealingPool pool;
+ *     asynchronous::wait(pool, graph.run(pool));
+ *
+ * NOTE: - the graph and the executor must outlive the run
+ *       - after a task threw, the remaining tasks are skipped,
+ *         and the future returned by run gets the (first) exception
+ *       - the graph must not be changed while it is running
+ */
+class TaskGraph
+{
+public:
+    using node_t = size_t;
+    using task_t = std::function<void()>;
+    using clock_t = std::chrono::steady_clock;
+    using duration_t = std::chrono::nanoseconds;
+    using timepoint_t = clock_t::time_point;
+
+    static constexpr node_t npos = std::numeric_limits<node_t>::max();
+
+    /**
+     * when a task ran, relative to the start of the run
+     */
+    struct NodeTiming
+    {
+        node_t          node = npos;
+        std::string     name;
+        duration_t      start{0};
+        duration_t      duration{0};
+        std::thread::id thread;
+    };
+
+private:
+    struct Node
+    {
+        std::string         name;
+        task_t              task;
+        std::vector<node_t> successors;
+        size_t              inDegree = 0;
+
+        std::atomic<size_t> pending{0};
+        timepoint_t         start;
+        timepoint_t         end;
+        std::thread::id     thread;
+
+        Node(task_t t, std::string n) : name(std::move(n)), task(std::move(t)) {}
+    };
+
+    std::deque<Node>        ivNodes;        // stable addresses
+    std::vector<node_t>     ivOrder;        // topological order of the last check
+
+    std::atomic<bool>       ivRunning;
+    std::atomic<bool>       ivFailed;
+    std::atomic<size_t>     ivRemaining;
+    std::mutex              ivFailureMutex;
+    std::exception_ptr      ivFailure;
+    std::promise<void>      ivPromise;
+    timepoint_t             ivStart;
+
+    /**
+     * throws std::logic_error if the graph has a cycle
+     * and sets ivOrder to a topological order
+     */
+    void checkAcyclic();
+
+    /**
+     * reset the counters for a new run
+     * @return the future of the run
+     */
+    std::future<void> prepareRun();
+
+    /**
+     * run the task of this node
+     */
+    void runTask(Node& node);
+
+    /**
+     * sets the promise of the run
+     */
+    void finish();
+
+    template<typename EXECUTOR>
+    void release(EXECUTOR& executor, node_t index)
+    {
+        executor.execute( [this, &executor, index] () { runFrom(executor, index); } );
+    }
+
+    /**
+     * run the node, and continue with one of the successors it releases
+     */
+    template<typename EXECUTOR>
+    void runFrom(EXECUTOR& executor, node_t index)
+    {
+        while (index != npos)
+        {
+            auto& node = ivNodes[index];
+            runTask(node);
+
+            node_t next = npos;
+            for(auto successor : node.successors)
+            {
+                if (ivNodes[successor].pending.fetch_sub(1) != 1) { continue; }
+                if (next == npos) { next = successor; }
+                else { release(executor, successor); }
+            }
+
+            // the last one must not touch the graph after finish
+            if (ivRemaining.fetch_sub(1) == 1) { finish(); return; }
+            index = next;
+        }
+    }
+
+public:
+    TaskGraph();
+
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator = (const TaskGraph&) = delete;
+
+    /**
+     * add a task
+     * @param task the job to run
+     * @param name for the timings
+     * @return the node of the task
+     */
+    node_t add(task_t task, std::string name = std::string());
+
+    /**
+     * let a task wait for another one
+     * throws std::invalid_argument for unknown nodes or before == after
+     * @param before the predecessor
+     * @param after the successor, runs only after before finished
+     */
+    void precede(node_t before, node_t after);
+
+    /**
+     * @return the number of tasks
+     */
+    size_t size() const { return ivNodes.size(); }
+
+    /**
+     * start all tasks without predecessors on the executor
+     * throws std::logic_error if the graph has a cycle or is already running
+     * @param executor to run the tasks
+     * @return a future that gets ready, when all tasks are done
+     */
+    template<typename EXECUTOR, typename = enable_if_executor_t<EXECUTOR> >
+    std::future<void> run(EXECUTOR& executor)
+    {
+        auto future = prepareRun();
+        if (ivNodes.empty())
+        {
+            finish();
+            return future;
+        }
+
+        for(node_t index = 0; index < ivNodes.size(); ++index)
+        {
+            if (ivNodes[index].inDegree == 0) { release(executor, index); }
+        }
+        return future;
+    }
+
+    /**
+     * @return the timings of the last run, in the order the tasks started
+     */
+    std::vector<NodeTiming> getTimings() const;
+
+    /**
+     * @return the chain of tasks with the longest total duration
+     *         in the last run, that bounds the runtime of the graph
+     */
+    std::vector<node_t> getCriticalPath() const;
+
+    /**
+     * write the timings of the last run in the Chrome trace event format
+     * (chrome://tracing or https://ui.perfetto.dev show them)
+     * @param s the stream to write to
+     */
+    void writeTimings(std::ostream& s) const;
+};
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
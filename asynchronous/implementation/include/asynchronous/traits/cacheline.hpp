@@ -0,0 +1,51 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include <cstddef>
+
+//******************************************************************************
+namespace asynchronous { namespace traits {
+//******************************************************************************
+
+/**
+ * the size of a cache line on the platforms we care about
+ * NOTE: std::hardware_destructive_interference_size would be the
+ *       portable choice, but gcc warns about its use in headers
+ */
+constexpr size_t cacheLineSize = 64;
+
+/**
+ * wraps a value into its own cache line,
+ * so that neighbors in an array do not share it ("false sharing")
+ */
+template<typename T>
+struct alignas(cacheLineSize) CacheLinePadded
+{
+    T value;
+};
+
+//******************************************************************************
+}}  // namespace asynchronous::traits
+//******************************************************************************
@@ -23,35 +23,151 @@
 #pragma once
 
 //******************************************************************************
+#include "asynchronous/awaitable.hpp"
+#include "asynchronous/lock_profile.hpp"
+#include "asynchronous/seqlock.hpp"
+#include "asynchronous/traits/cacheline.hpp"
+
 #include <mutex>
 #include <condition_variable>
 #include <memory>
 #include <chrono>
+#include <functional>
+#include <tuple>
+#include <vector>
+#include <algorithm>
+#include <string>
 
 //******************************************************************************
 namespace asynchronous {
 //******************************************************************************
 
+/**
+ * how a WaiterImpl wakes up the blocked waiters after a modification
+ */
+enum class WakeUp
+{
+    broadcast, //!< all blocked waiters are woken up whenever the shared predicate returns true
+    targeted   //!< every blocked waiter keeps its own copy of the predicate (with its own setup)
+               //!< and only those waiters are woken up, whose predicate returns true
+               //!< NOTE: asynchronous waiters (when_ready, async_wait) always keep their own copy
+};
+
+/**
+ * where a WaiterImpl keeps its mutex and condition variable:
+ * HeapStorage allocates them, so the waiter stays movable (the default)
+ */
+class HeapStorage
+{
+public:
+    using mutex_t = std::mutex;
+    using cond_t = std::condition_variable;
+
+private:
+    std::unique_ptr<mutex_t> ivMutex;
+    std::unique_ptr<cond_t>  ivCondition;
+
+public:
+    HeapStorage() :
+        ivMutex(new mutex_t()),
+        ivCondition(new cond_t())
+    {}
+
+    mutex_t& mutex() const { return *ivMutex; }
+    cond_t& condition() const { return *ivCondition; }
+};
+
+/**
+ * InlineStorage keeps them inside the waiter, aligned to a cache line,
+ * so the whole waiter starts on its own cache line and an array of waiters
+ * needs no extra allocations and has no false sharing between neighbors.
+ * NOTE: a waiter with InlineStorage is neither copyable nor movable
+ */
+class alignas(traits::cacheLineSize) InlineStorage
+{
+public:
+    using mutex_t = std::mutex;
+    using cond_t = std::condition_variable;
+
+private:
+    mutable mutex_t ivMutex;
+    mutable cond_t  ivCondition;
+
+public:
+    InlineStorage() = default;
+    InlineStorage(const InlineStorage&) = delete;
+    InlineStorage& operator = (const InlineStorage&) = delete;
+
+    mutex_t& mutex() const { return ivMutex; }
+    cond_t& condition() const { return ivCondition; }
+};
+
+namespace details {
+//******************************************************************************
+/**
+ * like HeapStorage, but with a ProfiledMutex
+ * (and so a std::condition_variable_any)
+ */
+class ProfiledStorage
+{
+public:
+    using mutex_t = ProfiledMutex<std::mutex>;
+    using cond_t = std::condition_variable_any;
+
+private:
+    std::unique_ptr<mutex_t> ivMutex;
+    std::unique_ptr<cond_t>  ivCondition;
+
+public:
+    ProfiledStorage() :
+        ivMutex(new mutex_t()),
+        ivCondition(new cond_t())
+    {}
+
+    mutex_t& mutex() const { return *ivMutex; }
+    cond_t& condition() const { return *ivCondition; }
+};
+
+//******************************************************************************
+}  // namespace details
+
+/**
+ * ProfiledStorage records the contention of the waiter's mutex
+ * if ASYNCHRONOUS_LOCK_PROFILING is defined project wide (see LockProfileRegistry),
+ * and is just HeapStorage otherwise
+ */
+#if defined(ASYNCHRONOUS_LOCK_PROFILING)
+using ProfiledStorage = details::ProfiledStorage;
+#else
+using ProfiledStorage = HeapStorage;
+#endif
+
 /**
  * This class contains a value and a predicate for this value
  * and allows to wait on a modification of that value,
  * that makes the predicate return true.
  *
  */
-template<typename T, typename PREDICATE>
+template<typename T, typename PREDICATE,
+         WakeUp WAKEUP = WakeUp::broadcast,
+         typename READ = LockedRead,
+         typename STORAGE = HeapStorage>
 class WaiterImpl
 {
 public:
-    using mutex_t = std::mutex;
+    using storage_t = STORAGE;
+    using mutex_t = typename storage_t::mutex_t;
     using lock_t  = std::unique_lock<mutex_t>;
-    using mutex_ptr_t = std::unique_ptr<mutex_t>;
-    using cond_t = std::condition_variable;
-    using cond_ptr_t = std::unique_ptr<cond_t>;
+    using cond_t = typename storage_t::cond_t;
     using value_t = T;
     using pred_t  = PREDICATE;
     using clock_t = std::chrono::steady_clock;
     using duration_t = clock_t::duration;
     using timepoint_t = clock_t::time_point;
+    using callback_t = std::function<void()>;
+    using read_t = READ;
+
+    static constexpr WakeUp wakeup = WAKEUP;
 
 private:
     /**
@@ -136,23 +252,43 @@ private:
     private:
         friend class WaiterImpl;
 
-        using ConstUpdater::ConstUpdater;
-
         WaiterImpl* getWaiter() { return const_cast<WaiterImpl*>(this->ivWaiterPtr); }
         value_t* getValue() { return &(getWaiter()->ivValue); }
 
-    public:
-        ~Updater()
+        Updater(lock_t lock, WaiterImpl* waiter) :
+            ConstUpdater(std::move(lock), waiter)
+        {
+            waiter->ivRead.beginWrite();
+        }
+
+        /**
+         * finish the write on our waiter (if any):
+         * tell the read path, notify the waiters and release the lock
+         */
+        void finish()
         {
-            if (this->ivWaiterPtr)
-            { getWaiter()->checkAndNotify(this->ivLock); }
+            if (not this->ivWaiterPtr) { return; }
+
+            getWaiter()->ivRead.endWrite();
+            getWaiter()->checkAndNotify(this->ivLock);
+            auto ready = getWaiter()->takeReadyWaiters(this->ivLock);
+            this->ivLock.unlock();
+            this->ivWaiterPtr = nullptr;
+            runWaiters(ready);
         }
 
+    public:
+        ~Updater() { finish(); }
+
         Updater(Updater&& other) : ConstUpdater(std::move(other)) {}
 
         Updater& operator = (Updater&& other)
         {
-            ConstUpdater::operator =(std::move(other));
+            if (&other != this)
+            {
+                finish();
+                ConstUpdater::operator =(std::move(other));
+            }
             return *this;
         }
 
@@ -184,10 +320,10 @@ private:
     };
 
 private:
-    mutex_ptr_t  ivMutex;
-    cond_ptr_t   ivCondition;
+    storage_t    ivStorage;
     value_t      ivValue;
     pred_t       ivPredicate;
+    read_t       ivRead;
 
     /**
      * the following is a circumvention
@@ -198,6 +334,105 @@ private:
      */
     unsigned int ivGeneration;
 
+    /**
+     * an asynchronous waiter, registered by when_ready
+     * it keeps its own copy of the predicate (with its own setup),
+     * so a later setup of the shared predicate does not change its target
+     */
+    struct AsyncWaiter
+    {
+        pred_t      predicate;
+        callback_t  callback;
+    };
+
+    /**
+     * the asynchronous waiters, registered by when_ready,
+     * they are handed to their executor as soon as their own predicate returns true
+     */
+    std::vector<AsyncWaiter> ivAsyncWaiters;
+
+    /**
+     * the asynchronous waiters whose predicate returned true,
+     * they are taken under the lock (see takeReadyWaiters) and run after it is released,
+     * so the executor (or an inline resumed coroutine) may use this waiter again
+     */
+    std::vector<callback_t> ivReadyWaiters;
+
+    /**
+     * a blocked waiter in WakeUp::targeted mode
+     * it lives on the stack of the waiting thread
+     */
+    struct WaitNode
+    {
+        cond_t  condition;
+        pred_t  predicate;
+        bool    ready;
+
+        explicit WaitNode(const pred_t& pred) :
+            condition(),
+            predicate(pred),
+            ready(false)
+        {}
+    };
+
+    /**
+     * the waiters that are blocked in WakeUp::targeted mode
+     */
+    std::vector<WaitNode*> ivWaitList;
+
+    /**
+     * wake up only those waiters, whose own predicate returns true now
+     * @param lock to synchronize this object
+     */
+    void notifyWaitList(const lock_t&)
+    {
+        auto ready = std::partition(ivWaitList.begin(), ivWaitList.end(),
+                                    [this](const WaitNode* node)
+                                    { return not node->predicate.test(ivValue); });
+
+        for (auto iter = ready; iter != ivWaitList.end(); ++iter)
+        {
+            (*iter)->ready = true;
+            (*iter)->condition.notify_one();
+        }
+        ivWaitList.erase(ready, ivWaitList.end());
+    }
+
+    /**
+     * move the asynchronous waiters, whose own predicate returns true now,
+     * to the ready waiters
+     * @param lock to synchronize this object
+     */
+    void notifyAsyncWaiters(const lock_t&)
+    {
+        // the predicates need not be assignable, so the waiting ones are moved to a new vector
+        std::vector<AsyncWaiter> waiting;
+        for (auto& waiter : ivAsyncWaiters)
+        {
+            if (waiter.predicate.test(ivValue)) { ivReadyWaiters.push_back(std::move(waiter.callback)); }
+            else { waiting.push_back(std::move(waiter)); }
+        }
+        ivAsyncWaiters.swap(waiting);
+    }
+
+    /**
+     * block on a WaitNode of our own until it is marked ready or a timeout occurs
+     * @param lock to synchronize this object
+     * @param timepoint when the timeout should occur
+     * @return false if timeout has occurred.
+     */
+    bool waitOnNode(lock_t& lock, const timepoint_t& timepoint)
+    {
+        WaitNode node(ivPredicate);
+        ivWaitList.push_back(&node);
+
+        if (node.condition.wait_until(lock, timepoint, [&node]() { return node.ready; }))
+        { return true; }
+
+        ivWaitList.erase(std::find(ivWaitList.begin(), ivWaitList.end(), &node));
+        return false;
+    }
+
     /**
      * @param lock to synchronize this object
      * @return the result of pred_t::test
@@ -217,7 +452,7 @@ private:
     { return static_cast<bool>(ivPredicate.setup(ivValue, std::forward<ARGS>(args)...)); }
 
 protected:
-    lock_t getLock() const { return lock_t(*ivMutex); }
+    lock_t getLock() const { return lock_t(ivStorage.mutex()); }
 
     /**
      * @brief seems like the condition_variable does not wait for timepoint::max()
@@ -238,15 +473,56 @@ protected:
      */
     bool checkAndNotify(const lock_t& l)
     {
+        if constexpr (WAKEUP == WakeUp::targeted)
+        { notifyWaitList(l); }
+
+        if (not ivAsyncWaiters.empty())
+        { notifyAsyncWaiters(l); }
+
         if (testPredicate(l))
         {
             ++ivGeneration;
-            ivCondition->notify_all();
+            ivStorage.condition().notify_all();
             return true;
         }
         return false;
     }
 
+    /**
+     * @param lock to synchronize this object
+     * @return the asynchronous waiters, that became ready with checkAndNotify
+     */
+    std::vector<callback_t> takeReadyWaiters(const lock_t&)
+    {
+        std::vector<callback_t> waiters;
+        waiters.swap(ivReadyWaiters);
+        return waiters;
+    }
+
+    /**
+     * hand the ready waiters to their executors
+     * NOTE: call it without holding the lock, this waiter might be gone already
+     * @param waiters taken by takeReadyWaiters
+     */
+    static void runWaiters(std::vector<callback_t>& waiters)
+    {
+        for (auto& waiter : waiters) { waiter(); }
+    }
+
+    /**
+     * run the ready waiters, releasing the lock for that
+     * @param lock to synchronize this object, it is locked again afterwards
+     */
+    void runReadyWaiters(lock_t& l)
+    {
+        auto waiters = takeReadyWaiters(l);
+        if (waiters.empty()) { return; }
+
+        l.unlock();
+        runWaiters(waiters);
+        l.lock();
+    }
+
     /**
      * make sure we set the value only under lock
      * @param lock to synchronize this object
@@ -255,7 +531,10 @@ protected:
     template<typename VALUE>
     void locked_setValue(const lock_t& l, VALUE&& value)
     {
-        ivValue = std::forward<VALUE>(value);
+        {
+            details::WriteGuard<read_t> guard(ivRead);
+            ivValue = std::forward<VALUE>(value);
+        }
         checkAndNotify(l);
     }
 
@@ -285,7 +564,9 @@ protected:
     {
         if (locked_try_wait(lock, std::forward<ARGS>(args)...)) { return true; }
 
-        return ivCondition->wait_until(lock, timepoint,
+        if constexpr (WAKEUP == WakeUp::targeted) { return waitOnNode(lock, timepoint); }
+
+        return ivStorage.condition().wait_until(lock, timepoint,
                    [myGeneration = ivGeneration, this]()
                    { return ivGeneration != myGeneration; }
         );
@@ -311,7 +592,10 @@ protected:
     template<typename CALLBACK>
     bool locked_modify(const lock_t& l, CALLBACK&& callback)
     {
-        std::forward<CALLBACK>(callback)(ivValue);
+        {
+            details::WriteGuard<read_t> guard(ivRead);
+            std::forward<CALLBACK>(callback)(ivValue);
+        }
         return checkAndNotify(l);
     }
 
@@ -328,6 +612,7 @@ protected:
                                       CALLBACK&& callback, ARGS&&... args)
     {
         locked_modify(l, std::forward<CALLBACK>(callback));
+        runReadyWaiters(l);
         return locked_wait_until(l, timepoint, std::forward<ARGS>(args)...);
     }
 
@@ -347,11 +632,14 @@ protected:
 
 public:
     explicit WaiterImpl(value_t value, pred_t predicate) :
-        ivMutex(new mutex_t()),
-        ivCondition(new cond_t()),
+        ivStorage(),
         ivValue(std::move(value)),
         ivPredicate(std::move(predicate)),
-        ivGeneration(0)
+        ivRead(),
+        ivGeneration(0),
+        ivAsyncWaiters(),
+        ivReadyWaiters(),
+        ivWaitList()
     {}
 
     explicit WaiterImpl(value_t value) : WaiterImpl(std::move(value), pred_t{})
@@ -416,16 +704,85 @@ public:
     bool wait_for(const duration_t& duration, ARGS&&... args)
     { return wait_until(clock_t::now() + duration, std::forward<ARGS>(args)...); }
 
+    /**
+     * the non-blocking version of wait:
+     * the callback is handed to the executor as soon as the predicate returns true
+     * (the predicate is copied with this setup, so later setups do not change it)
+     * if the predicate returns true already, it is handed over immediately
+     * NOTE: executor.execute is called without holding the lock of this waiter,
+     *       so the callback may use this waiter, even with the InlineExecutor
+     * @param executor the callback is executed on
+     * @param callback called without parameters
+     * @param args additional parameters to the setup functions
+     *        NOTE: the first parameter is the current value of this Waiter
+     */
+    template<typename EXECUTOR, typename CALLBACK, typename... ARGS>
+    void when_ready(EXECUTOR&& executor, CALLBACK&& callback, ARGS&&... args)
+    {
+        callback_t job = [exec = std::tuple<EXECUTOR>(std::forward<EXECUTOR>(executor)),
+                          callback = std::forward<CALLBACK>(callback)] () mutable
+                         { std::get<0>(exec).execute(std::move(callback)); };
+
+        auto l = getLock();
+        if (locked_try_wait(l, std::forward<ARGS>(args)...))
+        {
+            l.unlock();
+            job();
+            return;
+        }
+        ivAsyncWaiters.push_back(AsyncWaiter{ivPredicate, std::move(job)});
+    }
+
+    /**
+     * awaitable version of wait for C++20 coroutines:
+     *      co_await waiter.async_wait(executor, args...);
+     * if the predicate returns true already, the coroutine does not suspend
+     * @param executor the coroutine is resumed on
+     * @param args additional parameters to the setup functions
+     *        NOTE: the first parameter is the current value of this Waiter
+     * @return an awaitable
+     */
+    template<typename EXECUTOR, typename... ARGS>
+    auto async_wait(EXECUTOR&& executor, ARGS&&... args)
+    {
+        auto params = std::make_tuple(std::forward<ARGS>(args)...);
+        return details::makeAwaiter<void>(
+            [this, params] ()
+            { return std::apply( [this](const auto&... p) { return try_wait(p...); }, params); },
+            [this,
+             exec = std::tuple<EXECUTOR>(std::forward<EXECUTOR>(executor)),
+             params]
+            (auto callback) mutable
+            {
+                std::apply( [&](auto&&... p)
+                            {
+                                when_ready(std::forward<EXECUTOR>(std::get<0>(exec)),
+                                           std::move(callback),
+                                           std::forward<decltype(p)>(p)...);
+                            },
+                            std::move(params));
+            } );
+    }
+
     /**
      * run the callback to modify the value and
      * check the predicate after that.
      * if the predicate returned true, all waiters are notified
      * @param callback
+     * @param site where the lock is taken, for the lock profile (see ProfiledStorage)
      * @return what the predicate returned
      */
     template<typename CALLBACK>
-    bool modify(CALLBACK&& callback)
-    { return locked_modify(getLock(), std::forward<CALLBACK>(callback)); }
+    bool modify(CALLBACK&& callback, const LockSite& site = LockSite::current())
+    {
+        details::setLockSite(ivStorage.mutex(), site);
+        auto l = getLock();
+        const bool result = locked_modify(l, std::forward<CALLBACK>(callback));
+        auto ready = takeReadyWaiters(l);
+        l.unlock();
+        runWaiters(ready);
+        return result;
+    }
 
     /**
      * run the callback to modify the value and wait for the
@@ -484,23 +841,52 @@ public:
      * call the "operator =" with the new value and
      * notify the waiters, if the predicate returned true afterwards
      * @param value
+     * @param site where the lock is taken, for the lock profile (see ProfiledStorage)
      */
     template<typename VALUE>
-    void setValue(VALUE&& value)
-    { locked_setValue(getLock(), std::forward<VALUE>(value)); }
+    void setValue(VALUE&& value, const LockSite& site = LockSite::current())
+    {
+        details::setLockSite(ivStorage.mutex(), site);
+        auto l = getLock();
+        locked_setValue(l, std::forward<VALUE>(value));
+        auto ready = takeReadyWaiters(l);
+        l.unlock();
+        runWaiters(ready);
+    }
 
     /**
      * @return a copy of the curent value
+     *         with SeqLockRead without taking the lock
      */
     value_t getValue() const
-    { return locked_getValue(getLock()); }
+    {
+        if constexpr (read_t::lockFree) { return ivRead.read(ivValue); }
+        else { return locked_getValue(getLock()); }
+    }
+
+    /**
+     * name this waiter in the LockProfileRegistry
+     * does nothing, if the storage is not profiled
+     * @param name the name to report
+     */
+    void setProfileName(std::string name) { details::setProfileName(ivStorage.mutex(), std::move(name)); }
 
     /**
      * Create an update object that holds the lock while existing.
+     * @param site where the lock is taken, for the lock profile (see ProfiledStorage)
      * @return an guarding object providing synchronized access to the value
      */
-    Updater getUpdater() { return Updater(getLock(), this); }
-    ConstUpdater getUpdater() const { return ConstUpdater(getLock(), this); }
+    Updater getUpdater(const LockSite& site = LockSite::current())
+    {
+        details::setLockSite(ivStorage.mutex(), site);
+        return Updater(getLock(), this);
+    }
+
+    ConstUpdater getUpdater(const LockSite& site = LockSite::current()) const
+    {
+        details::setLockSite(ivStorage.mutex(), site);
+        return ConstUpdater(getLock(), this);
+    }
 
     /**
      * dereference operator to return a guarding updater object
@@ -521,8 +907,11 @@ public:
  * to avoid any syntax sugar, like "reference" or "const"
  * we have to decay the type and use this as the value type in the waiter
  */
-template<typename T, typename PREDICATE>
-using Waiter = WaiterImpl< typename std::decay<T>::type, PREDICATE>;
+template<typename T, typename PREDICATE,
+         WakeUp WAKEUP = WakeUp::broadcast,
+         typename READ = LockedRead,
+         typename STORAGE = HeapStorage>
+using Waiter = WaiterImpl< typename std::decay<T>::type, PREDICATE, WAKEUP, READ, STORAGE>;
 
 /**
  * convenient function to create a waiter for this value and this predicate
@@ -630,25 +1019,29 @@ using GreaterThan = GreaterThanImpl< std::decay_t<T> >;
 //******************************************************************************
 }  // namespace checker
 //******************************************************************************
-template<typename T>
-using WaiterForChange = Waiter< T, checker::HasChanged<T> >;
+template<typename T, WakeUp WAKEUP = WakeUp::broadcast,
+         typename READ = LockedRead, typename STORAGE = HeapStorage>
+using WaiterForChange = Waiter< T, checker::HasChanged<T>, WAKEUP, READ, STORAGE >;
 
-template<typename T>
-using WaiterForAtLeast = Waiter< T, checker::AtLeast<T> >;
+template<typename T, WakeUp WAKEUP = WakeUp::broadcast,
+         typename READ = LockedRead, typename STORAGE = HeapStorage>
+using WaiterForAtLeast = Waiter< T, checker::AtLeast<T>, WAKEUP, READ, STORAGE >;
 
 template<typename T>
 inline checker::EqualTo<T> isEqualTo(T&& t)
 { return checker::EqualTo<T>{std::forward<T>(t)}; }
 
-template<typename T>
-using WaiterForEqual = Waiter< T, checker::EqualTo<T> >;
+template<typename T, WakeUp WAKEUP = WakeUp::broadcast,
+         typename READ = LockedRead, typename STORAGE = HeapStorage>
+using WaiterForEqual = Waiter< T, checker::EqualTo<T>, WAKEUP, READ, STORAGE >;
 
 template<typename T>
 inline checker::GreaterThan<T> isGreaterThan(T&& t)
 { return checker::GreaterThan<T>{std::forward<T>(t)}; }
 
-template<typename T>
-using WaiterForGreater = Waiter< T, checker::GreaterThan<T> >;
+template<typename T, WakeUp WAKEUP = WakeUp::broadcast,
+         typename READ = LockedRead, typename STORAGE = HeapStorage>
+using WaiterForGreater = Waiter< T, checker::GreaterThan<T>, WAKEUP, READ, STORAGE >;
 
 //------------------------------------------------------------------------------
 /**
@@ -668,6 +1061,16 @@ template<typename T>
 inline WaiterForAtLeast<T> createWaiterForAtLeast(T&& value)
 { return WaiterForAtLeast<T>(std::forward<T>(value)); }
 
+/**
+ * @param value initial value
+ * @return  a WaitObject that wait until at least the value provided by
+ *          the wait call is reached, but only wakes up the waiters
+ *          whose value was reached (instead of all of them)
+ */
+template<typename T>
+inline WaiterForAtLeast<T, WakeUp::targeted> createTargetedWaiterForAtLeast(T&& value)
+{ return WaiterForAtLeast<T, WakeUp::targeted>(std::forward<T>(value)); }
+
 //------------------------------------------------------------------------------
 /**
  * this class implements a thread safe waiter for zero
@@ -707,7 +1110,15 @@ public:
             base_t{std::move(value), asynchronous::isEqualTo<value_t>(0)}
     {}
 
-    bool count_down() { return locked_count_down(check()); }
+    bool count_down()
+    {
+        auto l = check();
+        const bool result = locked_count_down(l);
+        auto ready = base_t::takeReadyWaiters(l);
+        l.unlock();
+        base_t::runWaiters(ready);
+        return result;
+    }
 
     bool count_down_and_wait_until(const timepoint_t& timepoint)
     {
@@ -723,15 +1134,15 @@ public:
 };
 
 //******************************************************************************
-template<typename T, typename P, typename K>
-inline WaiterImpl<T,P>& operator += (WaiterImpl<T,P>& w, K&& k)
+template<typename T, typename P, WakeUp W, typename R, typename S, typename K>
+inline WaiterImpl<T,P,W,R,S>& operator += (WaiterImpl<T,P,W,R,S>& w, K&& k)
 {
     w.modify([&k](T& v) { v+=k; });
     return w;
 }
 
-template<typename T, typename P, typename K>
-inline WaiterImpl<T,P>& operator -= (WaiterImpl<T,P>& w, K&& k)
+template<typename T, typename P, WakeUp W, typename R, typename S, typename K>
+inline WaiterImpl<T,P,W,R,S>& operator -= (WaiterImpl<T,P,W,R,S>& w, K&& k)
 {
     w.modify([&k](T& v) { v-=k; });
     return w;
@@ -0,0 +1,213 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/futurevalue.hpp"
+
+#include <atomic>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+/**
+ * @brief the result of when_any
+ *        NOTE: only the future at index is valid, all others stay invalid
+ */
+template<typename SEQUENCE>
+struct WhenAnyResult
+{
+    size_t      index = 0;
+    SEQUENCE    futures;
+};
+
+namespace details {
+//******************************************************************************
+
+/**
+ * @brief the shared state of when_all/when_any:
+ *        the callbacks of the input futures collect the results here,
+ *        and the last (when_all) or first (when_any) sets the promise
+ */
+template<typename RESULT>
+struct WhenState
+{
+    std::promise<RESULT>                ivPromise;
+    std::shared_ptr<ContinuationSlot>   ivContinuation;
+    RESULT                              ivResult;
+    std::atomic_size_t                  ivPending;
+
+    explicit WhenState(size_t pending) :
+        ivPromise(),
+        ivContinuation( std::make_shared<ContinuationSlot>() ),
+        ivResult(),
+        ivPending(pending)
+    {}
+
+    ContinuableFuture<RESULT> getFuture()
+    { return ContinuableFuture<RESULT>{ ivPromise.get_future(), ivContinuation }; }
+
+    void setResult()
+    {
+        ivPromise.set_value( std::move(ivResult) );
+        ivContinuation->fire();
+    }
+};
+
+template<typename STATE, typename FUTURE, size_t INDEX>
+inline void collectAll(const std::shared_ptr<STATE>& state, FUTURE& future)
+{
+    using future_t = std::future<typename FUTURE::Result_t>;
+
+    future.onReady( [state] (future_t ready)
+    {
+        std::get<INDEX>(state->ivResult) = std::move(ready);
+        if (--state->ivPending == 0) { state->setResult(); }
+    });
+}
+
+template<typename STATE, typename FUTURE, size_t INDEX>
+inline void collectAny(const std::shared_ptr<STATE>& state, FUTURE& future)
+{
+    using future_t = std::future<typename FUTURE::Result_t>;
+
+    future.onReady( [state] (future_t ready)
+    {
+        // the first one wins, all others are dropped
+        if (state->ivPending.exchange(0) == 0) { return; }
+
+        state->ivResult.index = INDEX;
+        std::get<INDEX>(state->ivResult.futures) = std::move(ready);
+        state->setResult();
+    });
+}
+
+template<typename STATE, typename... FUTURES, size_t... INDEX>
+inline void collectAll(const std::shared_ptr<STATE>& state, std::index_sequence<INDEX...>, FUTURES&... futures)
+{ (collectAll<STATE, FUTURES, INDEX>(state, futures), ...); }
+
+template<typename STATE, typename... FUTURES, size_t... INDEX>
+inline void collectAny(const std::shared_ptr<STATE>& state, std::index_sequence<INDEX...>, FUTURES&... futures)
+{ (collectAny<STATE, FUTURES, INDEX>(state, futures), ...); }
+
+//******************************************************************************
+}  // namespace details
+
+/**
+ * @brief returns a future that gets ready, when all futures are ready
+ *        No thread is blocked while waiting.
+ *
+ * @example:
+ *     asynchronous::FutureValue<int> a;
+ *     asynchronous::FutureValue<std::string> b;
+ *     auto both = asynchronous::when_all(a, b).then([](auto ready)
+ *                 {
+ *                     auto results = ready.get();
+ *                     return std::get<1>(results).get() + std::to_string(std::get<0>(results).get());
+ *                 });
+ *
+ * @param futures any number of FutureValue or ContinuableFuture,
+ *        NOTE: their futures are moved into the result
+ * @return ContinuableFuture< std::tuple< std::future<T>... > >
+ */
+template<typename... FUTURES, typename = std::void_t< typename FUTURES::Result_t... > >
+inline auto when_all(FUTURES&... futures)
+{
+    using result_t = std::tuple< std::future< typename FUTURES::Result_t >... >;
+    using state_t = details::WhenState<result_t>;
+
+    auto state = std::make_shared<state_t>( sizeof...(FUTURES) );
+    auto result = state->getFuture();
+
+    if constexpr (sizeof...(FUTURES) == 0)
+    { state->setResult(); }
+    else
+    { details::collectAll(state, std::index_sequence_for<FUTURES...>{}, futures...); }
+
+    return result;
+}
+
+/**
+ * @brief see above, but for a range of futures of the same type
+ * @return ContinuableFuture< std::vector< std::future<T> > >
+ */
+template<typename ITERATOR,
+         typename = typename std::iterator_traits<ITERATOR>::iterator_category >
+inline auto when_all(ITERATOR first, ITERATOR last)
+{
+    using value_t = typename std::iterator_traits<ITERATOR>::value_type::Result_t;
+    using result_t = std::vector< std::future<value_t> >;
+    using state_t = details::WhenState<result_t>;
+
+    const auto count = static_cast<size_t>( std::distance(first, last) );
+    auto state = std::make_shared<state_t>( count );
+    state->ivResult.resize(count);
+    auto result = state->getFuture();
+
+    if (count == 0) { state->setResult(); }
+
+    for(size_t index = 0; first != last; ++first, ++index)
+    {
+        first->onReady( [state, index] (std::future<value_t> ready)
+        {
+            state->ivResult[index] = std::move(ready);
+            if (--state->ivPending == 0) { state->setResult(); }
+        });
+    }
+
+    return result;
+}
+
+/**
+ * @brief returns a future that gets ready, when the first of the futures is ready
+ *        No thread is blocked while waiting.
+ * @param futures any number of FutureValue or ContinuableFuture,
+ *        NOTE: their futures are moved away, even those not handed out
+ * @return ContinuableFuture< WhenAnyResult< std::tuple< std::future<T>... > > >
+ */
+template<typename... FUTURES, typename = std::void_t< typename FUTURES::Result_t... > >
+inline auto when_any(FUTURES&... futures)
+{
+    static_assert(sizeof...(FUTURES) > 0, "when_any: needs at least one future");
+
+    using result_t = WhenAnyResult< std::tuple< std::future< typename FUTURES::Result_t >... > >;
+    using state_t = details::WhenState<result_t>;
+
+    auto state = std::make_shared<state_t>( 1 );
+    auto result = state->getFuture();
+
+    details::collectAny(state, std::index_sequence_for<FUTURES...>{}, futures...);
+
+    return result;
+}
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
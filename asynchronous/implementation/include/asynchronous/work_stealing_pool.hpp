@@ -0,0 +1,160 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#pragma once
+
+//******************************************************************************
+#include "asynchronous/traits/cacheline.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//******************************************************************************
+namespace asynchronous {
+//******************************************************************************
+
+/**
+ * this class implements a threadpool with a fixed number of threads
+ * where every thread has its own job queue.
+ * - jobs added by one of the pool threads go to the queue of that thread
+ *   and are taken from the back (LIFO, the data is still hot in the cache)
+ * - jobs added by other threads are spread round robin over all queues
+ * - a thread with an empty queue steals the oldest job from the front
+ *   of another queue
+ * - every thread (also a non pool thread) can run a pending job by calling
+ *   runPendingJob, which allows waiting for a job without blocking a pool thread
+ *
+ * NOTE: - the destructor runs all pending jobs and joins all threads
+ *         Calling execute while the destructor is running is undefined behavior
+ *         unless it is called from one of the jobs
+ *       - exceptions thrown by a job are ignored
+ *       - this class is not moveable because of its mutex
+ */
+class WorkStealingPool
+{
+public:
+    using Mutex = std::mutex;
+    using Lock = std::unique_lock<Mutex>;
+
+    using Job = std::function<void(void)>;
+
+private:
+    struct alignas(traits::cacheLineSize) Worker
+    {
+        Mutex           ivMutex;
+        std::deque<Job> ivJobs;
+
+        Lock getLock() { return Lock{ivMutex}; }
+    };
+
+    using Workers = std::vector< std::unique_ptr<Worker> >;
+
+    Workers                     ivWorkers;
+    std::atomic_size_t          ivPending;
+    std::atomic_size_t          ivSleeping;
+    std::atomic_size_t          ivNextWorker;
+
+    mutable Mutex               ivMutex;
+    std::condition_variable     ivCondition;
+    bool                        ivDone;
+
+    std::vector<std::thread>    ivThreads;
+
+    Lock getLock() const { return Lock{ivMutex}; }
+
+    /**
+     * @return the index of the worker the calling thread is, or size() if
+     *         the calling thread is not one of the pool threads
+     */
+    size_t getWorkerIndex() const;
+
+    /**
+     * try to take a job from the worker with the given index
+     * @param index of the worker
+     * @param fromBack take the newest (owner) or the oldest (thief) job
+     * @param job will be set, if there was one
+     * @return true if a job was taken
+     */
+    bool tryPop(size_t index, bool fromBack, Job& job);
+
+    /**
+     * the main loop of the pool thread with the given index
+     */
+    void worker(size_t index);
+
+    /**
+     * tell the started threads to finish and join them
+     */
+    void stop();
+
+public:
+    /**
+     * @param threadCount number of threads, at least one thread will be started
+     */
+    explicit WorkStealingPool(size_t threadCount = std::thread::hardware_concurrency());
+
+    /**
+     * the mutex prohibits copy and move
+     * so let's make it explicit
+     */
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator = (const WorkStealingPool&) = delete;
+    WorkStealingPool(WorkStealingPool&&) = delete;
+    WorkStealingPool& operator = (WorkStealingPool&&) = delete;
+
+    /**
+     * This blocks until all pending jobs are done
+     */
+    ~WorkStealingPool();
+
+    /**
+     * @return number of threads in this pool
+     */
+    size_t size() const { return ivWorkers.size(); }
+
+    /**
+     * @return true if the calling thread is one of the pool threads
+     */
+    bool isWorkerThread() const { return getWorkerIndex() < size(); }
+
+    /**
+     * add the job to the pool
+     * @param job
+     */
+    void execute(Job job);
+
+    /**
+     * run one pending job in the calling thread
+     * @return false if there was no job to run
+     */
+    bool runPendingJob();
+};
+
+//******************************************************************************
+}  // namespace asynchronous
+//******************************************************************************
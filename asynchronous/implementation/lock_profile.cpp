@@ -0,0 +1,203 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/lock_profile.hpp"
+
+#include <algorithm>
+#include <iomanip>
+
+//******************************************************************************
+namespace {
+//******************************************************************************
+using duration_t = asynchronous::LockStats::duration_t;
+
+void updateMax(std::atomic<long long>& value, long long candidate)
+{
+    auto current = value.load(std::memory_order_relaxed);
+    while (  (current < candidate)
+          && (not value.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) )
+    { /* retry */ }
+}
+
+double toMicroSeconds(duration_t d)
+{ return std::chrono::duration<double, std::micro>(d).count(); }
+
+//******************************************************************************
+}  // namespace anonymous
+//******************************************************************************
+std::ostream& asynchronous::operator << (std::ostream& s, const LockStats& stats)
+{
+    auto flags = s.flags();
+    auto precision = s.precision();
+
+    s << std::fixed << std::setprecision(1)
+      << (stats.name.empty() ? std::string("<unnamed>") : stats.name)
+      << ": acquisitions=" << stats.acquisitions
+      << " contentions=" << stats.contentions
+      << " wait=" << toMicroSeconds(stats.waitTime) << "us"
+      << " (max " << toMicroSeconds(stats.maxWaitTime) << "us)"
+      << " hold=" << toMicroSeconds(stats.holdTime) << "us"
+      << " (max " << toMicroSeconds(stats.maxHoldTime) << "us)";
+
+    for(const auto& site : stats.longHolds)
+    { s << "\n    long hold at " << site.first << ": " << toMicroSeconds(site.second) << "us"; }
+
+    s.flags(flags);
+    s.precision(precision);
+    return s;
+}
+
+std::ostream& asynchronous::operator << (std::ostream& s, const LockSite& site)
+{
+    if (not site.isKnown()) { return s << "<unknown>"; }
+    return s << site.file << ':' << site.line;
+}
+
+//------------------------------------------------------------------------------
+asynchronous::LockProfile::LockProfile(std::string name) :
+        ivMutex(),
+        ivName(std::move(name)),
+        ivLongHolds(),
+        ivNextLongHold{0},
+        ivAcquisitions{0},
+        ivContentions{0},
+        ivWaitTime{0},
+        ivMaxWaitTime{0},
+        ivHoldTime{0},
+        ivMaxHoldTime{0}
+{
+    LockProfileRegistry::instance().add(this);
+}
+
+asynchronous::LockProfile::~LockProfile()
+{
+    LockProfileRegistry::instance().remove(this);
+}
+
+void asynchronous::LockProfile::setName(std::string name)
+{
+    std::lock_guard<std::mutex> lck(ivMutex);
+    ivName = std::move(name);
+}
+
+void asynchronous::LockProfile::acquired(duration_t wait)
+{
+    ivAcquisitions.fetch_add(1, std::memory_order_relaxed);
+    if (wait.count() == 0) { return; }
+
+    ivContentions.fetch_add(1, std::memory_order_relaxed);
+    ivWaitTime.fetch_add(wait.count(), std::memory_order_relaxed);
+    updateMax(ivMaxWaitTime, wait.count());
+}
+
+void asynchronous::LockProfile::released(duration_t hold, const LockSite& site)
+{
+    ivHoldTime.fetch_add(hold.count(), std::memory_order_relaxed);
+    updateMax(ivMaxHoldTime, hold.count());
+
+    if (hold < LockProfileRegistry::instance().getLongHoldThreshold()) { return; }
+
+    // keep the latest long holds
+    std::lock_guard<std::mutex> lck(ivMutex);
+    if (ivLongHolds.size() < maxLongHolds)
+    { ivLongHolds.emplace_back(site, hold); }
+    else
+    { ivLongHolds[ivNextLongHold] = LockStats::site_t(site, hold); }
+    ivNextLongHold = (ivNextLongHold + 1) % maxLongHolds;
+}
+
+asynchronous::LockStats asynchronous::LockProfile::getStats() const
+{
+    LockStats stats;
+    stats.acquisitions = ivAcquisitions.load(std::memory_order_relaxed);
+    stats.contentions = ivContentions.load(std::memory_order_relaxed);
+    stats.waitTime = duration_t(ivWaitTime.load(std::memory_order_relaxed));
+    stats.maxWaitTime = duration_t(ivMaxWaitTime.load(std::memory_order_relaxed));
+    stats.holdTime = duration_t(ivHoldTime.load(std::memory_order_relaxed));
+    stats.maxHoldTime = duration_t(ivMaxHoldTime.load(std::memory_order_relaxed));
+
+    std::lock_guard<std::mutex> lck(ivMutex);
+    stats.name = ivName;
+    stats.longHolds = ivLongHolds;
+    return stats;
+}
+
+//------------------------------------------------------------------------------
+asynchronous::LockProfileRegistry::LockProfileRegistry() :
+        ivMutex(),
+        ivProfiles(),
+        ivLongHoldThreshold{std::chrono::duration_cast<duration_t>(std::chrono::milliseconds(1)).count()}
+{}
+
+asynchronous::LockProfileRegistry& asynchronous::LockProfileRegistry::instance()
+{
+    static LockProfileRegistry registry;
+    return registry;
+}
+
+void asynchronous::LockProfileRegistry::add(LockProfile* profile)
+{
+    std::lock_guard<std::mutex> lck(ivMutex);
+    ivProfiles.push_back(profile);
+}
+
+void asynchronous::LockProfileRegistry::remove(LockProfile* profile)
+{
+    std::lock_guard<std::mutex> lck(ivMutex);
+    ivProfiles.erase(std::remove(ivProfiles.begin(), ivProfiles.end(), profile), ivProfiles.end());
+}
+
+void asynchronous::LockProfileRegistry::setLongHoldThreshold(duration_t threshold)
+{
+    ivLongHoldThreshold.store(threshold.count(), std::memory_order_relaxed);
+}
+
+auto asynchronous::LockProfileRegistry::getLongHoldThreshold() const -> duration_t
+{
+    return duration_t(ivLongHoldThreshold.load(std::memory_order_relaxed));
+}
+
+std::vector<asynchronous::LockStats> asynchronous::LockProfileRegistry::getStats() const
+{
+    std::lock_guard<std::mutex> lck(ivMutex);
+
+    std::vector<LockStats> result;
+    result.reserve(ivProfiles.size());
+    for(const auto* profile : ivProfiles)
+    { result.push_back(profile->getStats()); }
+    return result;
+}
+
+std::vector<asynchronous::LockStats> asynchronous::LockProfileRegistry::getTopOffenders(size_t count) const
+{
+    auto result = getStats();
+    std::stable_sort(result.begin(), result.end(),
+                     [](const LockStats& a, const LockStats& b) { return a.waitTime > b.waitTime; });
+    if (result.size() > count) { result.resize(count); }
+    return result;
+}
+
+void asynchronous::LockProfileRegistry::report(std::ostream& s, size_t count) const
+{
+    for(const auto& stats : getTopOffenders(count))
+    { s << stats << '\n'; }
+}
@@ -42,18 +42,15 @@ namespace asynchronous {
             return threads;
         }
 
-        void run_jobs_thread(std::atomic_size_t & index_next_job,
-                             Tasks & tasks)
+        using Walker = details::PartitionWalker< Tasks::iterator >;
+
+        void run_jobs_thread(Walker & walker)
         {
-            const auto maxIndex = tasks.size();
-            while (1)
+            walker.walk([](const Walker::Range & range)
             {
-                const auto index = index_next_job++;
-                if (index >= maxIndex)
-                    break;
-                auto & task = tasks[index];
-                task();
-            }
+                for(auto task = range.first; task != range.last; ++task)
+                    (*task)();
+            });
         }
     }
 
@@ -66,10 +63,25 @@ namespace asynchronous {
      * @exception std::invalid_argument if the number or threads or task are insane
      */
     void run_tasks(Tasks  & tasks, size_t threadnumber) {
+        run_tasks(tasks, threadnumber, Partition{});
+    }
+
+    /**
+     * Run tasks in a limited number of threads.
+     * It returns when all tasks are done
+
+     * @param  tasks        container of std::packaged_task. The container must offer an index operator
+     * @param  threadnumber maximum number of threads
+     * @param  partition    how the tasks are handed out to the threads
+     * @exception std::invalid_argument if the number or threads or task are insane
+     */
+    void run_tasks(Tasks  & tasks, size_t threadnumber, const Partition & partition) {
 
-        std::atomic_size_t index_next_job(0);
+        // the walker has to outlive the futures, because their destructors wait for the threads
+        Walker walker(tasks.begin(), tasks.size(), std::min(threadnumber, tasks.size()), partition);
 
         auto threads = makeFutures(tasks.size(), threadnumber);
+        threadnumber = std::min(threadnumber, tasks.size());
 
         for(size_t i = 0; i < threadnumber; ++i)
         {
@@ -77,8 +89,7 @@ namespace asynchronous {
                 std::async(
                     std::launch::async,
                     run_jobs_thread,
-                    std::ref(index_next_job),
-                    std::ref(tasks)
+                    std::ref(walker)
                 )
             );
         }
@@ -0,0 +1,88 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/snapshotvalue.hpp"
+
+#include <algorithm>
+
+//******************************************************************************
+namespace {
+//******************************************************************************
+using EpochDomain = asynchronous::details::EpochDomain;
+
+/**
+ * every reading thread keeps its slot until it ends,
+ * then the slot can be used by another thread
+ */
+struct ThisSlot
+{
+    EpochDomain::Slot* ivSlot = nullptr;
+
+    ~ThisSlot()
+    {
+        if (ivSlot) { ivSlot->used.store(false); }
+    }
+};
+
+thread_local ThisSlot thisSlot;
+
+//******************************************************************************
+}  // namespace anonymous
+//******************************************************************************
+EpochDomain::Slot& EpochDomain::acquireSlot()
+{
+    std::lock_guard<std::mutex> lock(ivMutex);
+
+    Slot* result = nullptr;
+    for (auto& slot : ivSlots)
+    {
+        bool expected = false;
+        if (slot->used.compare_exchange_strong(expected, true))
+        {
+            result = slot.get();
+            break;
+        }
+    }
+
+    if (not result)
+    {
+        ivSlots.emplace_back(new Slot());
+        result = ivSlots.back().get();
+        result->used.store(true);
+    }
+
+    thisSlot.ivSlot = result;   // to give it back at thread end
+    return *result;
+}
+
+EpochDomain::epoch_t EpochDomain::oldestActive() const
+{
+    auto oldest = ivEpoch.load(std::memory_order_seq_cst);
+
+    std::lock_guard<std::mutex> lock(ivMutex);
+    for (auto& slot : ivSlots)
+    {
+        auto epoch = slot->epoch.load(std::memory_order_seq_cst);
+        if (epoch != 0) { oldest = std::min(oldest, epoch); }
+    }
+    return oldest;
+}
@@ -0,0 +1,132 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/spillingqueue.hpp"
+
+#include <cerrno>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+//******************************************************************************
+using SpillSegment = asynchronous::details::SpillSegment;
+
+//******************************************************************************
+#if defined(__unix__) || defined(__APPLE__)
+//******************************************************************************
+namespace {
+//******************************************************************************
+[[noreturn]] void throwSystemError(const std::string& what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+//******************************************************************************
+}  // namespace anonymous
+//******************************************************************************
+SpillSegment::SpillSegment(const std::string& directory, size_t capacity) :
+        ivPath(),
+        ivFile(-1),
+        ivData(nullptr),
+        ivCapacity(capacity),
+        ivWriteOffset(0),
+        ivReadOffset(0)
+{
+    auto dir = directory.empty() ? std::filesystem::temp_directory_path() : std::filesystem::path(directory);
+    std::string name = (dir / "asynchronous-spill-XXXXXX").string();
+
+    ivFile = ::mkstemp(&name[0]);
+    if (ivFile < 0) { throwSystemError("SpillSegment: can not create " + name); }
+    ivPath = name;
+
+    void* data = MAP_FAILED;
+    if (::ftruncate(ivFile, static_cast<off_t>(ivCapacity)) == 0)
+    { data = ::mmap(nullptr, ivCapacity, PROT_READ | PROT_WRITE, MAP_SHARED, ivFile, 0); }
+
+    if (data == MAP_FAILED)
+    {
+        const int error = errno;
+        ::close(ivFile);
+        ::unlink(ivPath.c_str());
+        errno = error;
+        throwSystemError("SpillSegment: can not map " + ivPath);
+    }
+    ivData = static_cast<char*>(data);
+}
+
+SpillSegment::~SpillSegment()
+{
+    ::munmap(ivData, ivCapacity);
+    ::close(ivFile);
+    ::unlink(ivPath.c_str());
+}
+
+//******************************************************************************
+#else
+//******************************************************************************
+SpillSegment::SpillSegment(const std::string&, size_t capacity) :
+        ivPath(),
+        ivFile(-1),
+        ivData(nullptr),
+        ivCapacity(capacity),
+        ivWriteOffset(0),
+        ivReadOffset(0)
+{
+    throw std::runtime_error("SpillSegment: memory mapped files are not supported on this platform");
+}
+
+SpillSegment::~SpillSegment()
+{}
+
+//******************************************************************************
+#endif
+//******************************************************************************
+char* SpillSegment::append(size_t size)
+{
+    if (size > std::numeric_limits<length_t>::max())
+    { throw std::length_error("SpillSegment: record too large"); }
+
+    if (ivCapacity - ivWriteOffset < headerSize + size) { return nullptr; }
+
+    const auto length = static_cast<length_t>(size);
+    std::memcpy(ivData + ivWriteOffset, &length, headerSize);
+    char* record = ivData + ivWriteOffset + headerSize;
+    ivWriteOffset += headerSize + size;
+    return record;
+}
+
+const char* SpillSegment::next(size_t& size)
+{
+    length_t length = 0;
+    std::memcpy(&length, ivData + ivReadOffset, headerSize);
+    const char* record = ivData + ivReadOffset + headerSize;
+    ivReadOffset += headerSize + length;
+    size = length;
+    return record;
+}
@@ -0,0 +1,249 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/taskgraph.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <stdexcept>
+
+//******************************************************************************
+using TaskGraph = asynchronous::TaskGraph;
+
+//******************************************************************************
+namespace {
+//******************************************************************************
+/**
+ * escape the name for a JSON string
+ */
+std::string escape(const std::string& name)
+{
+    std::string result;
+    result.reserve(name.size());
+    for(char c : name)
+    {
+        if ((c == '"') || (c == '\\')) { result += '\\'; }
+        if (static_cast<unsigned char>(c) < 0x20) { result += ' '; continue; }
+        result += c;
+    }
+    return result;
+}
+
+double toMicroSeconds(TaskGraph::duration_t d)
+{ return std::chrono::duration<double, std::micro>(d).count(); }
+
+//******************************************************************************
+}  // namespace anonymous
+//******************************************************************************
+TaskGraph::TaskGraph() :
+        ivNodes(),
+        ivOrder(),
+        ivRunning{false},
+        ivFailed{false},
+        ivRemaining{0},
+        ivFailureMutex(),
+        ivFailure(),
+        ivPromise(),
+        ivStart()
+{}
+
+TaskGraph::node_t TaskGraph::add(task_t task, std::string name)
+{
+    if (ivRunning) { throw std::logic_error("TaskGraph: can not add while running"); }
+
+    ivNodes.emplace_back(std::move(task), std::move(name));
+    return ivNodes.size() - 1;
+}
+
+void TaskGraph::precede(node_t before, node_t after)
+{
+    if ((before >= ivNodes.size()) || (after >= ivNodes.size()))
+    { throw std::invalid_argument("TaskGraph: unknown node"); }
+    if (before == after)
+    { throw std::invalid_argument("TaskGraph: a node can not precede itself"); }
+    if (ivRunning) { throw std::logic_error("TaskGraph: can not change while running"); }
+
+    ivNodes[before].successors.push_back(after);
+    ++ivNodes[after].inDegree;
+}
+
+void TaskGraph::checkAcyclic()
+{
+    // Kahn's algorithm
+    std::vector<size_t> inDegree(ivNodes.size());
+    ivOrder.clear();
+    ivOrder.reserve(ivNodes.size());
+
+    for(node_t index = 0; index < ivNodes.size(); ++index)
+    {
+        inDegree[index] = ivNodes[index].inDegree;
+        if (inDegree[index] == 0) { ivOrder.push_back(index); }
+    }
+
+    for(size_t i = 0; i < ivOrder.size(); ++i)
+    {
+        for(auto successor : ivNodes[ivOrder[i]].successors)
+        {
+            if (--inDegree[successor] == 0) { ivOrder.push_back(successor); }
+        }
+    }
+
+    if (ivOrder.size() != ivNodes.size()) { throw std::logic_error("TaskGraph: the graph has a cycle"); }
+}
+
+std::future<void> TaskGraph::prepareRun()
+{
+    if (ivRunning.exchange(true)) { throw std::logic_error("TaskGraph: already running"); }
+
+    try
+    { checkAcyclic(); }
+    catch(...)
+    {
+        ivRunning = false;
+        throw;
+    }
+
+    for(auto& node : ivNodes)
+    {
+        node.pending = node.inDegree;
+        node.start = timepoint_t();
+        node.end = timepoint_t();
+        node.thread = std::thread::id();
+    }
+
+    ivFailed = false;
+    ivFailure = nullptr;
+    ivRemaining = ivNodes.size();
+    ivPromise = std::promise<void>();
+    ivStart = clock_t::now();
+    return ivPromise.get_future();
+}
+
+void TaskGraph::runTask(Node& node)
+{
+    node.thread = std::this_thread::get_id();
+    node.start = clock_t::now();
+
+    if (not ivFailed)
+    {
+        try
+        { node.task(); }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lck(ivFailureMutex);
+            if (not ivFailure) { ivFailure = std::current_exception(); }
+            ivFailed = true;
+        }
+    }
+
+    node.end = clock_t::now();
+}
+
+void TaskGraph::finish()
+{
+    // the waiting thread may destroy the graph as soon as the promise is set
+    auto promise = std::move(ivPromise);
+    auto failure = ivFailure;
+    ivRunning = false;
+
+    if (failure) { promise.set_exception(failure); }
+    else { promise.set_value(); }
+}
+
+std::vector<TaskGraph::NodeTiming> TaskGraph::getTimings() const
+{
+    std::vector<NodeTiming> result;
+    result.reserve(ivNodes.size());
+
+    for(node_t index = 0; index < ivNodes.size(); ++index)
+    {
+        const auto& node = ivNodes[index];
+        NodeTiming timing;
+        timing.node = index;
+        timing.name = node.name;
+        timing.start = std::chrono::duration_cast<duration_t>(node.start - ivStart);
+        timing.duration = std::chrono::duration_cast<duration_t>(node.end - node.start);
+        timing.thread = node.thread;
+        result.push_back(std::move(timing));
+    }
+
+    std::stable_sort(result.begin(), result.end(),
+                     [](const NodeTiming& a, const NodeTiming& b) { return a.start < b.start; });
+    return result;
+}
+
+std::vector<TaskGraph::node_t> TaskGraph::getCriticalPath() const
+{
+    // longest path by duration, in topological order
+    std::vector<duration_t> finish(ivNodes.size(), duration_t{0});
+    std::vector<node_t> previous(ivNodes.size(), npos);
+
+    node_t last = npos;
+    for(auto index : ivOrder)
+    {
+        const auto& node = ivNodes[index];
+        finish[index] += std::chrono::duration_cast<duration_t>(node.end - node.start);
+        if ((last == npos) || (finish[index] > finish[last])) { last = index; }
+
+        for(auto successor : node.successors)
+        {
+            if ((previous[successor] == npos) || (finish[index] > finish[successor]))
+            {
+                finish[successor] = finish[index];
+                previous[successor] = index;
+            }
+        }
+    }
+
+    std::vector<node_t> path;
+    for(auto index = last; index != npos; index = previous[index]) { path.push_back(index); }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+void TaskGraph::writeTimings(std::ostream& s) const
+{
+    std::map<std::thread::id, size_t> threads;
+    auto flags = s.flags();
+    auto precision = s.precision();
+
+    s << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+    bool first = true;
+    for(const auto& timing : getTimings())
+    {
+        auto thread = threads.emplace(timing.thread, threads.size()).first->second;
+        auto name = timing.name.empty() ? ("node " + std::to_string(timing.node)) : timing.name;
+
+        s << (first ? "\n" : ",\n")
+          << "{\"name\":\"" << escape(name) << "\",\"ph\":\"X\""
+          << ",\"ts\":" << toMicroSeconds(timing.start)
+          << ",\"dur\":" << toMicroSeconds(timing.duration)
+          << ",\"pid\":0,\"tid\":" << thread
+          << ",\"args\":{\"node\":" << timing.node << "}}";
+        first = false;
+    }
+    s << "\n]}\n";
+
+    s.flags(flags);
+    s.precision(precision);
+}
@@ -0,0 +1,186 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/work_stealing_pool.hpp"
+#include <algorithm>
+
+//******************************************************************************
+namespace {
+//******************************************************************************
+/**
+ * every pool thread knows its pool and its index,
+ * so jobs added from inside a job go to the own queue
+ */
+struct ThisWorker
+{
+    const asynchronous::WorkStealingPool* ivPool = nullptr;
+    size_t ivIndex = 0;
+};
+
+thread_local ThisWorker thisWorker;
+
+//******************************************************************************
+}  // namespace anonymous
+//******************************************************************************
+asynchronous::WorkStealingPool::WorkStealingPool(size_t threadCount) :
+        ivWorkers(),
+        ivPending{0},
+        ivSleeping{0},
+        ivNextWorker{0},
+        ivMutex(),
+        ivCondition(),
+        ivDone(false),
+        ivThreads()
+{
+    threadCount = std::max<size_t>(threadCount, 1);
+
+    ivWorkers.reserve(threadCount);
+    for(size_t i = 0; i < threadCount; ++i)
+    { ivWorkers.emplace_back( new Worker() ); }
+
+    ivThreads.reserve(threadCount);
+    try
+    {
+        for(size_t i = 0; i < threadCount; ++i)
+        { ivThreads.emplace_back( &WorkStealingPool::worker, this, i ); }
+    }
+    catch(...)
+    {
+        // the destructor is not called, but the started threads must not stay joinable
+        stop();
+        throw;
+    }
+}
+
+asynchronous::WorkStealingPool::~WorkStealingPool()
+{
+    stop();
+}
+
+void asynchronous::WorkStealingPool::stop()
+{
+    {
+        auto lck = getLock();
+        ivDone = true;
+    }
+    ivCondition.notify_all();
+
+    for(auto& thread : ivThreads)
+    { thread.join(); }
+}
+
+size_t asynchronous::WorkStealingPool::getWorkerIndex() const
+{
+    if (thisWorker.ivPool != this) { return size(); }
+    return thisWorker.ivIndex;
+}
+
+bool asynchronous::WorkStealingPool::tryPop(size_t index, bool fromBack, Job& job)
+{
+    auto& worker = *ivWorkers[index];
+    auto lck = worker.getLock();
+
+    if (worker.ivJobs.empty()) { return false; }
+
+    if (fromBack)
+    {
+        job = std::move(worker.ivJobs.back());
+        worker.ivJobs.pop_back();
+    }
+    else
+    {
+        job = std::move(worker.ivJobs.front());
+        worker.ivJobs.pop_front();
+    }
+
+    --ivPending;
+    return true;
+}
+
+void asynchronous::WorkStealingPool::execute(Job job)
+{
+    auto index = getWorkerIndex();
+    if (index == size()) { index = ivNextWorker++ % size(); }
+
+    {
+        auto& worker = *ivWorkers[index];
+        auto lck = worker.getLock();
+        worker.ivJobs.push_back(std::move(job));
+        ++ivPending;
+    }
+
+    // ivPending and ivSleeping are sequentially consistent,
+    // so either the sleeping thread sees the new job
+    // or this thread sees the sleeping thread
+    if (ivSleeping > 0)
+    {
+        { auto lck = getLock(); }
+        ivCondition.notify_one();
+    }
+}
+
+bool asynchronous::WorkStealingPool::runPendingJob()
+{
+    if (ivPending == 0) { return false; }
+
+    const auto self = getWorkerIndex();
+    const auto count = size();
+
+    Job job;
+    bool found = (self < count) && tryPop(self, true, job);
+
+    // steal the oldest job from the others, starting with the next neighbor
+    for(size_t i = 1; (not found) && (i <= count); ++i)
+    {
+        const auto index = (self + i) % count;
+        if (index != self) { found = tryPop(index, false, job); }
+    }
+
+    if (not found) { return false; }
+
+    try
+    { job(); }
+    catch(...)
+    { /* ignore */ }
+
+    return true;
+}
+
+void asynchronous::WorkStealingPool::worker(size_t index)
+{
+    thisWorker.ivPool = this;
+    thisWorker.ivIndex = index;
+
+    while(true)
+    {
+        if (runPendingJob()) { continue; }
+
+        auto lck = getLock();
+        ++ivSleeping;
+        ivCondition.wait(lck, [this] { return ivDone || (ivPending > 0); });
+        --ivSleeping;
+
+        if (ivDone && (ivPending == 0)) { break; }
+    }
+
+    thisWorker = ThisWorker{};
+}
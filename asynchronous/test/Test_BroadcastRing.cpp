@@ -0,0 +1,218 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/broadcastring.hpp"
+#include "asynchronous/queue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+using ms = std::chrono::milliseconds;
+
+//******************************************************************************
+TEST( Test_BroadcastRing, every_consumer_gets_every_item )
+{
+    asynchronous::SharedBroadcastRing<std::string, 8> ring;
+
+    auto c1 = ring->subscribe();
+    auto c2 = ring->subscribe();
+    EXPECT_EQ(2u, ring->getConsumerCount());
+
+    EXPECT_TRUE(ring->push("one"));
+    EXPECT_TRUE(ring->push(3, 'x'));
+
+    auto c3 = ring->subscribe();    // gets only the items pushed from now on
+    EXPECT_TRUE(ring->push("three"));
+
+    EXPECT_EQ(3u, c1.size());
+    EXPECT_EQ("one", c1.pop().value);
+    EXPECT_EQ("xxx", c1.pop().value);
+    EXPECT_EQ("three", c1.pop().value);
+    EXPECT_EQ(asynchronous::PopState<decltype(ring)>::empty, c1.try_pop().state);
+
+    EXPECT_EQ("one", c2.pop().value);
+    EXPECT_EQ("xxx", c2.pop().value);
+    EXPECT_EQ("three", c2.pop().value);
+
+    EXPECT_EQ(1u, c3.size());
+    EXPECT_EQ("three", c3.pop().value);
+    EXPECT_EQ(asynchronous::PopState<decltype(ring)>::timeout, c3.pop_wait_for(ms(1)).state);
+
+    EXPECT_FALSE(c1.isLagging());
+}   // TEST every_consumer_gets_every_item
+
+//------------------------------------------------------------------------------
+TEST( Test_BroadcastRing, finish )
+{
+    auto writer = std::make_unique< asynchronous::SharedBroadcastRing<int, 4> >();
+    asynchronous::BroadcastRing<int, 4> reader = writer->as_reader();
+    auto consumer = reader->subscribe();
+
+    (*writer)->push(1);
+    (*writer)->push(2);
+    writer.reset();     // the last writer is gone
+
+    EXPECT_TRUE(reader->isDone());
+    EXPECT_FALSE(reader->push(3));
+    EXPECT_EQ(1, consumer.pop().value);
+    EXPECT_EQ(2, consumer.pop().value);
+    EXPECT_FALSE(consumer.pop());
+}   // TEST finish
+
+//------------------------------------------------------------------------------
+TEST( Test_BroadcastRing, backpressure )
+{
+    asynchronous::SharedBroadcastRing<int, 2> ring;
+    auto fast = ring->subscribe();
+    auto slow = ring->subscribe();
+
+    std::atomic_int pushed{0};
+    std::thread producer([&ring, &pushed]()
+            {
+                for(int i = 1; i <= 4; ++i) { ring->push(i); ++pushed; }
+            });
+
+    EXPECT_EQ(1, fast.pop().value);
+    EXPECT_EQ(2, fast.pop().value);
+
+    std::this_thread::sleep_for(ms(10));
+    EXPECT_EQ(2, pushed);   // waits for the slow consumer
+    EXPECT_EQ(asynchronous::PopState<decltype(ring)>::timeout, fast.pop_wait_for(ms(1)).state);
+
+    for(int i = 1; i <= 4; ++i) { EXPECT_EQ(i, slow.pop().value); }
+    EXPECT_EQ(3, fast.pop().value);
+    EXPECT_EQ(4, fast.pop().value);
+    producer.join();
+    EXPECT_FALSE(slow.isLagging());
+}   // TEST backpressure
+
+//------------------------------------------------------------------------------
+TEST( Test_BroadcastRing, unsubscribe_releases_the_writer )
+{
+    asynchronous::SharedBroadcastRing<int, 2> ring;
+    auto consumer = std::make_unique< asynchronous::BroadcastConsumer<decltype(ring)::state_t> >(ring->subscribe());
+
+    ring->push(1);
+    ring->push(2);
+
+    std::thread producer([&ring]() { ring->push(3); });
+    std::this_thread::sleep_for(ms(10));
+    consumer.reset();
+    producer.join();
+
+    EXPECT_EQ(3u, ring->getItemCount());
+    EXPECT_EQ(0u, ring->getConsumerCount());
+}   // TEST unsubscribe_releases_the_writer
+
+//------------------------------------------------------------------------------
+TEST( Test_BroadcastRing, lagging )
+{
+    asynchronous::SharedBroadcastRing<int, 4, asynchronous::Overflow::lagging> ring;
+    auto consumer = ring->subscribe();
+
+    for(int i = 1; i <= 10; ++i) { EXPECT_TRUE(ring->push(i)); }   // never blocks
+
+    EXPECT_TRUE(consumer.isLagging());
+    EXPECT_EQ(6u, consumer.getLostItemCount());
+    EXPECT_EQ(4u, consumer.size());
+    for(int i = 7; i <= 10; ++i) { EXPECT_EQ(i, consumer.pop().value); }
+}   // TEST lagging
+
+//------------------------------------------------------------------------------
+TEST( Test_BroadcastRing, threads )
+{
+    constexpr int count = 10000;
+    constexpr size_t consumerCount = 4;
+
+    auto writer = std::make_unique< asynchronous::SharedBroadcastRing<int, 64> >();
+
+    std::vector< asynchronous::BroadcastConsumer< asynchronous::basic_broadcast_ring<int, 64> > > consumers;
+    for(size_t i = 0; i < consumerCount; ++i) { consumers.push_back((*writer)->subscribe()); }
+
+    std::vector<long long> sums(consumerCount, 0);
+    std::vector<std::thread> threads;
+    for(size_t i = 0; i < consumerCount; ++i)
+    {
+        threads.emplace_back([&consumers, &sums, i]()
+                {
+                    for(auto r = consumers[i].pop(); r; r = consumers[i].pop()) { sums[i] += r.value; }
+                });
+    }
+
+    for(int i = 1; i <= count; ++i) { (*writer)->push(i); }
+    writer.reset();
+
+    for(auto& t : threads) { t.join(); }
+    for(auto sum : sums) { EXPECT_EQ(count * (count + 1) / 2, sum); }
+}   // TEST threads
+
+//------------------------------------------------------------------------------
+// NOTE: this is a benchmark, run it with --gtest_also_run_disabled_tests
+TEST( Test_BroadcastRing, DISABLED_benchmark )
+{
+    constexpr int count = 100000;
+    constexpr size_t consumerCount = 4;
+    using value_t = std::vector<int>;   // something worth copying
+    const value_t item(16, 1);
+
+    auto measure = [count](auto&& produce, auto&& consume)
+    {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for(size_t i = 0; i < consumerCount; ++i) { threads.emplace_back(consume, i); }
+        produce();
+        for(auto& t : threads) { t.join(); }
+        return (std::chrono::steady_clock::now() - start) / count;
+    };
+
+    // one queue per consumer, N copies of every item
+    std::vector< asynchronous::SharedQueue<value_t> > queues(consumerCount);
+    std::vector< asynchronous::Reader< asynchronous::basic_capped_queue<value_t, std::numeric_limits<size_t>::max()> > > readers;
+    for(auto& q : queues) { readers.push_back(q.as_reader()); }
+    auto perQueue = measure(
+            [&]() { for(int i = 0; i < count; ++i) { for(auto& q : queues) { q->push(item); } } queues.clear(); },
+            [&](size_t i) { while(readers[i]->pop()) {} });
+
+    // one ring
+    auto ring = std::make_unique< asynchronous::SharedBroadcastRing<value_t, 1024> >();
+    std::vector< asynchronous::BroadcastConsumer< asynchronous::basic_broadcast_ring<value_t, 1024> > > consumers;
+    for(size_t i = 0; i < consumerCount; ++i) { consumers.push_back((*ring)->subscribe()); }
+    auto broadcast = measure(
+            [&]() { for(int i = 0; i < count; ++i) { (*ring)->push(item); } ring.reset(); },
+            [&](size_t i) { while(consumers[i].pop()) {} });
+
+    std::cout << consumerCount << " consumers, per item: one SharedQueue each "
+              << perQueue.count() << "ns, SharedBroadcastRing " << broadcast.count() << "ns" << std::endl;
+}   // TEST DISABLED_benchmark
+
+//******************************************************************************
+// EOF
+//******************************************************************************
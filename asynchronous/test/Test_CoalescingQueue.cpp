@@ -0,0 +1,155 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/coalescingqueue.hpp"
+#include "asynchronous/queue.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+using ms = std::chrono::milliseconds;
+
+//******************************************************************************
+TEST( Test_CoalescingQueue, latest_value_wins )
+{
+    using queue_t = asynchronous::SharedCoalescingQueue<std::string, int>;
+    queue_t q;
+
+    EXPECT_TRUE(q->push("a", 1));
+    EXPECT_TRUE(q->push("b", 1));
+    EXPECT_TRUE(q->push("a", 2));   // replaces a's value, a stays first
+    EXPECT_TRUE(q->push("c", 1));
+    EXPECT_TRUE(q->push("b", 3));
+
+    EXPECT_EQ(3u, q->size());
+    EXPECT_EQ(5u, q->getItemCount());
+    EXPECT_EQ(2u, q->getMergedItemCount());
+
+    auto r = q->pop();
+    ASSERT_TRUE(r);
+    EXPECT_EQ("a", r.value.first);
+    EXPECT_EQ(2, r.value.second);
+
+    EXPECT_TRUE(q->push("a", 4));   // popped already, so queued again at the end
+
+    EXPECT_EQ(std::make_pair(std::string("b"), 3), q->try_pop().value);
+    EXPECT_EQ(std::make_pair(std::string("c"), 1), q->try_pop().value);
+    EXPECT_EQ(std::make_pair(std::string("a"), 4), q->try_pop().value);
+
+    EXPECT_EQ(asynchronous::PopState<queue_t>::empty, q->try_pop().state);
+    EXPECT_EQ(asynchronous::PopState<queue_t>::timeout, q->pop_wait_for(ms(1)).state);
+    EXPECT_EQ(3u, q->getMaxQueueSize());
+}   // TEST latest_value_wins
+
+//------------------------------------------------------------------------------
+TEST( Test_CoalescingQueue, finish )
+{
+    auto writer = std::make_unique< asynchronous::SharedCoalescingQueue<int, std::string> >();
+    asynchronous::CoalescingQueue<int, std::string> reader = writer->as_reader();
+
+    (*writer)->push(1, 3, 'x');
+    writer.reset();
+
+    EXPECT_TRUE(reader->isDone());
+    EXPECT_FALSE(reader->push(2, "late"));
+    EXPECT_EQ("xxx", reader->pop().value.second);
+    EXPECT_FALSE(reader->pop());
+}   // TEST finish
+
+//------------------------------------------------------------------------------
+TEST( Test_CoalescingQueue, bounded_by_keys )
+{
+    constexpr int keys = 10;
+    constexpr int updates = 10000;
+
+    auto writer = std::make_unique< asynchronous::SharedCoalescingQueue<int, int> >();
+    asynchronous::CoalescingQueue<int, int> reader = writer->as_reader();
+
+    std::thread producer([&writer]()
+            {
+                for(int i = 1; i <= updates; ++i) { (*writer)->push(i % keys, i); }
+                writer.reset();
+            });
+
+    std::vector<int> latest(keys, 0);
+    while(auto r = reader->pop())
+    {
+        EXPECT_LT(latest[r.value.first], r.value.second);   // only newer values
+        latest[r.value.first] = r.value.second;
+    }
+    producer.join();
+
+    for(int k = 0; k < keys; ++k) { EXPECT_EQ(updates - keys + (k == 0 ? keys : k), latest[k]); }
+    EXPECT_LE(reader->getMaxQueueSize(), size_t{keys});
+}   // TEST bounded_by_keys
+
+//------------------------------------------------------------------------------
+// NOTE: this is a benchmark, run it with --gtest_also_run_disabled_tests
+TEST( Test_CoalescingQueue, DISABLED_benchmark )
+{
+    constexpr int keys = 100;
+    constexpr int updates = 1000000;
+    const auto work = std::chrono::microseconds(1);   // the consumer is slower than the producer
+
+    auto measure = [work](auto& writer, auto reader, auto&& push)
+    {
+        auto start = std::chrono::steady_clock::now();
+        size_t consumed = 0;
+        std::thread consumer([&]()
+                {
+                    while(reader->pop())
+                    {
+                        ++consumed;
+                        auto end = std::chrono::steady_clock::now() + work;
+                        while(std::chrono::steady_clock::now() < end) {}
+                    }
+                });
+        for(int i = 0; i < updates; ++i) { push(*writer, i % keys, i); }
+        writer.reset();
+        consumer.join();
+        return std::make_pair(std::chrono::duration_cast<ms>(std::chrono::steady_clock::now() - start), consumed);
+    };
+
+    auto queue = std::make_unique< asynchronous::SharedQueue< std::pair<int, int> > >();
+    auto queueReader = queue->as_reader();
+    auto plain = measure(queue, queueReader, [](auto& q, int k, int v) { q->push(k, v); });
+
+    auto coalescing = std::make_unique< asynchronous::SharedCoalescingQueue<int, int> >();
+    auto coalescingReader = coalescing->as_reader();
+    auto merged = measure(coalescing, coalescingReader, [](auto& q, int k, int v) { q->push(k, v); });
+
+    std::cout << updates << " updates of " << keys << " keys: SharedQueue "
+              << plain.first.count() << "ms (" << plain.second << " consumed), SharedCoalescingQueue "
+              << merged.first.count() << "ms (" << merged.second << " consumed)" << std::endl;
+}   // TEST DISABLED_benchmark
+
+//******************************************************************************
+// EOF
+//******************************************************************************
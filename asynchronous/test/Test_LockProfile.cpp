@@ -0,0 +1,255 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/lock_profile.hpp"
+#include "asynchronous/synchronizedvalue.hpp"
+#include "asynchronous/waiter.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+namespace {
+//******************************************************************************
+using Registry = asynchronous::LockProfileRegistry;
+
+asynchronous::LockStats findStats(const std::string& name)
+{
+    for(const auto& stats : Registry::instance().getStats())
+    {
+        if (stats.name == name) { return stats; }
+    }
+    return asynchronous::LockStats();
+}
+
+//******************************************************************************
+}  // namespace
+
+//******************************************************************************
+TEST( Test_LockProfile, policies )
+{
+    using asynchronous::details::ProfiledLock;
+    static_assert( std::is_same< ProfiledLock<asynchronous::ExclusiveLock>::shared_guard_t,
+                                 ProfiledLock<asynchronous::ExclusiveLock>::guard_t >::value );
+    static_assert( std::is_same< ProfiledLock<asynchronous::SharedLock>::shared_guard_t,
+                                 std::shared_lock< asynchronous::ProfiledMutex<std::shared_mutex> > >::value );
+
+    // the public policies are profiled only with the project wide ASYNCHRONOUS_LOCK_PROFILING
+#if defined(ASYNCHRONOUS_LOCK_PROFILING)
+    static_assert( std::is_same< asynchronous::ProfiledLock<>, ProfiledLock<asynchronous::ExclusiveLock> >::value );
+    static_assert( std::is_same< asynchronous::ProfiledStorage, asynchronous::details::ProfiledStorage >::value );
+#else
+    static_assert( std::is_same< asynchronous::ProfiledLock<>, asynchronous::ExclusiveLock >::value );
+    static_assert( std::is_same< asynchronous::ProfiledStorage, asynchronous::HeapStorage >::value );
+#endif
+}   // TEST policies
+
+//------------------------------------------------------------------------------
+TEST( Test_LockProfile, synchronized_value )
+{
+    asynchronous::SynchronizedValue<int, asynchronous::LockedRead, asynchronous::details::ProfiledLock<asynchronous::ExclusiveLock> > value(0);
+    value.setProfileName("Test_LockProfile.synchronized_value");
+
+    constexpr int threadCount = 4;
+    constexpr int loops = 1000;
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&value]()
+                {
+                    for(int i = 0; i < loops; ++i) { ++(*value.getUpdater()); }
+                });
+    }
+    for(auto& thread : threads) { thread.join(); }
+
+    EXPECT_EQ(threadCount * loops, value.getValue());
+
+    auto stats = findStats("Test_LockProfile.synchronized_value");
+    EXPECT_EQ(size_t{threadCount * loops + 1}, stats.acquisitions);
+    EXPECT_LE(stats.contentions, stats.acquisitions);
+    EXPECT_LE(stats.maxWaitTime, stats.waitTime);
+    EXPECT_LE(stats.maxHoldTime, stats.holdTime);
+}   // TEST synchronized_value
+
+//------------------------------------------------------------------------------
+TEST( Test_LockProfile, shared )
+{
+    asynchronous::SynchronizedValue<int, asynchronous::LockedRead,
+                                    asynchronous::details::ProfiledLock<asynchronous::SharedLock> > value(42);
+    value.setProfileName("Test_LockProfile.shared");
+
+    const auto& constValue = value;
+    {
+        auto r1 = constValue.getUpdater();
+        auto r2 = constValue.getUpdater();     // readers share the lock
+        EXPECT_EQ(42, *r1);
+        EXPECT_EQ(42, *r2);
+    }
+    *value.getUpdater() = 7;
+
+    auto stats = findStats("Test_LockProfile.shared");
+    EXPECT_EQ(3u, stats.acquisitions);
+    EXPECT_EQ(0u, stats.contentions);
+}   // TEST shared
+
+//------------------------------------------------------------------------------
+TEST( Test_LockProfile, waiter )
+{
+    asynchronous::WaiterForAtLeast<size_t, asynchronous::WakeUp::broadcast,
+                                   asynchronous::LockedRead,
+                                   asynchronous::details::ProfiledStorage> waiter(0);
+    waiter.setProfileName("Test_LockProfile.waiter");
+
+    auto f = std::async(std::launch::async, [&waiter]()
+            {
+                for(int i = 0; i < 10; ++i) { waiter += 1; }
+            });
+    waiter.wait(size_t{10});
+    f.get();
+
+    EXPECT_EQ(10u, waiter.getValue());
+
+    auto stats = findStats("Test_LockProfile.waiter");
+    EXPECT_GE(stats.acquisitions, 11u);
+}   // TEST waiter
+
+//------------------------------------------------------------------------------
+TEST( Test_LockProfile, long_holds )
+{
+    auto& registry = Registry::instance();
+    const auto threshold = registry.getLongHoldThreshold();
+    registry.setLongHoldThreshold(std::chrono::milliseconds(1));
+
+    asynchronous::SynchronizedValue<int, asynchronous::LockedRead, asynchronous::details::ProfiledLock<asynchronous::ExclusiveLock> > value(0);
+    value.setProfileName("Test_LockProfile.long_holds");
+
+    for(size_t i = 0; i < asynchronous::LockProfile::maxLongHolds + 2; ++i)
+    {
+        auto updater = value.getUpdater();
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    { auto updater = value.getUpdater(); }     // short, not sampled
+
+    registry.setLongHoldThreshold(threshold);
+
+    auto stats = findStats("Test_LockProfile.long_holds");
+    EXPECT_EQ(asynchronous::LockProfile::maxLongHolds, stats.longHolds.size());
+    for(const auto& site : stats.longHolds)
+    { EXPECT_GE(site.second, std::chrono::milliseconds(1)); }
+    EXPECT_GE(stats.maxHoldTime, std::chrono::milliseconds(2));
+}   // TEST long_holds
+
+//------------------------------------------------------------------------------
+TEST( Test_LockProfile, call_sites )
+{
+    auto& registry = Registry::instance();
+    const auto threshold = registry.getLongHoldThreshold();
+    registry.setLongHoldThreshold(asynchronous::LockStats::duration_t{0});     // sample every hold
+
+    asynchronous::SynchronizedValue<int, asynchronous::LockedRead, asynchronous::details::ProfiledLock<asynchronous::ExclusiveLock> > value(0);
+    value.setProfileName("Test_LockProfile.call_sites");
+
+    { auto updater = value.getUpdater(); }  const unsigned first = __LINE__;
+    { auto updater = value.getUpdater(); }  const unsigned second = __LINE__;
+
+    registry.setLongHoldThreshold(threshold);
+
+    auto stats = findStats("Test_LockProfile.call_sites");
+    ASSERT_EQ(2u, stats.longHolds.size());
+    EXPECT_EQ(first, stats.longHolds[0].first.line);
+    EXPECT_EQ(second, stats.longHolds[1].first.line);
+    EXPECT_NE(std::string::npos, std::string(stats.longHolds[0].first.file).find("Test_LockProfile.cpp"));
+
+    std::ostringstream s;
+    s << stats;
+    EXPECT_NE(std::string::npos, s.str().find("Test_LockProfile.cpp:" + std::to_string(first) + ": "));
+    EXPECT_NE(std::string::npos, s.str().find("Test_LockProfile.cpp:" + std::to_string(second) + ": "));
+}   // TEST call_sites
+
+//------------------------------------------------------------------------------
+TEST( Test_LockProfile, registry )
+{
+    auto before = Registry::instance().getStats().size();
+    {
+        asynchronous::ProfiledMutex<std::mutex> quiet;
+        asynchronous::ProfiledMutex<std::mutex> busy;
+        quiet.setName("Test_LockProfile.quiet");
+        busy.setName("Test_LockProfile.busy");
+        EXPECT_EQ(before + 2, Registry::instance().getStats().size());
+
+        busy.lock();
+        auto f = std::async(std::launch::async, [&busy]()
+                {
+                    std::lock_guard<asynchronous::ProfiledMutex<std::mutex> > lck(busy);
+                });
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        busy.unlock();
+        f.get();
+
+        auto top = Registry::instance().getTopOffenders(1);
+        ASSERT_EQ(1u, top.size());
+        EXPECT_EQ("Test_LockProfile.busy", top.front().name);
+        EXPECT_EQ(1u, top.front().contentions);
+
+        std::ostringstream s;
+        Registry::instance().report(s, 2);
+        EXPECT_EQ(0u, s.str().find("Test_LockProfile.busy: acquisitions=2 contentions=1"));
+    }
+    EXPECT_EQ(before, Registry::instance().getStats().size());
+}   // TEST registry
+
+//------------------------------------------------------------------------------
+// NOTE: this is a benchmark, run it with --gtest_also_run_disabled_tests
+TEST( Test_LockProfile, DISABLED_benchmark )
+{
+    constexpr size_t loops = 1000000;
+
+    auto measure = [](auto& value)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for(size_t i = 0; i < loops; ++i) { ++(*value.getUpdater()); }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / loops;
+    };
+
+    asynchronous::SynchronizedValue<size_t> plain(0);
+    asynchronous::SynchronizedValue<size_t, asynchronous::LockedRead, asynchronous::details::ProfiledLock<asynchronous::ExclusiveLock> > profiled(0);
+    profiled.setProfileName("Test_LockProfile.benchmark");
+
+    std::cout << "plain lock   : " << measure(plain) << "ns per update" << std::endl;
+    std::cout << "profiled lock: " << measure(profiled) << "ns per update" << std::endl;
+    Registry::instance().report(std::cout, 3);
+}   // TEST DISABLED_benchmark
+
+//******************************************************************************
+// EOF
+//******************************************************************************
@@ -0,0 +1,198 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/pipeline.hpp"
+#include "asynchronous/latch.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+using ms = std::chrono::milliseconds;
+
+TEST( Test_Pipeline, ordered )
+{
+    auto pipeline = asynchronous::Pipeline<std::string>{4}
+                        .stage("parse", 4, 4, [](const std::string& s) { return std::stoi(s); })
+                        .stage("square", 3, 4, [](int a)
+                               {
+                                   std::this_thread::sleep_for(ms(a % 3));
+                                   return a * a;
+                               }, asynchronous::StageOrder::ordered);
+
+    constexpr int count = 100;
+    std::thread producer([&pipeline]
+            {
+                for(int i = 0; i < count; ++i) { EXPECT_TRUE(pipeline.push(std::to_string(i))); }
+                pipeline.close();
+                EXPECT_FALSE(pipeline.push("too late"));
+            });
+
+    int expected = 0;
+    while(auto r = pipeline.pop())
+    {
+        EXPECT_EQ(expected * expected, r.value);
+        ++expected;
+    }
+    producer.join();
+    EXPECT_EQ(count, expected);
+
+    auto stats = pipeline.getStats();
+    ASSERT_EQ(2u, stats.size());
+    EXPECT_EQ("parse", stats[0].name);
+    EXPECT_EQ(4u, stats[0].threadCount);
+    EXPECT_EQ(size_t{count}, stats[0].processed);
+    EXPECT_GE(4u, stats[0].maxQueueDepth);
+    EXPECT_EQ(4u, stats[1].queueCapacity);
+    EXPECT_EQ(size_t{count}, stats[1].processed);
+}   // TEST ordered
+
+TEST( Test_Pipeline, unordered_with_failures )
+{
+    auto pipeline = asynchronous::Pipeline<int>{}
+                        .stage("check", 2, 10, [](int a)
+                               {
+                                   if (a % 10 == 0) { throw std::runtime_error("multiple of 10"); }
+                                   return a;
+                               })
+                        .stage("toString", 2, 10, [](int a) { return std::to_string(a); },
+                               asynchronous::StageOrder::ordered);
+
+    // the ordered stage limits the values in flight to its capacity
+    std::thread producer([&pipeline]
+            {
+                for(int i = 1; i <= 30; ++i) { pipeline.push(i); }
+                pipeline.close();
+            });
+
+    std::ostringstream log;
+    size_t count = 0;
+    while(auto r = pipeline.pop())
+    {
+        log << r.value << ' ';
+        ++count;
+    }
+
+    producer.join();
+
+    // the failed values are skipped, the order is restored by the second stage
+    EXPECT_EQ(27u, count);
+    EXPECT_EQ(0u, log.str().find("1 2 3 4 5 6 7 8 9 11 "));
+
+    auto stats = pipeline.getStats();
+    EXPECT_EQ(3u, stats[0].failed);
+    EXPECT_EQ(27u, stats[0].processed);
+
+    std::ostringstream statsLog;
+    statsLog << stats[0];
+    EXPECT_EQ(0u, statsLog.str().find("check: threads=2, processed=27, failed=3"));
+}   // TEST unordered_with_failures
+
+TEST( Test_Pipeline, destroy_while_full )
+{
+    // nobody pops the results, the destructor must not block
+    auto pipeline = asynchronous::Pipeline<int>{2}
+                        .stage("identity", 2, 2, [](int a) { return a; });
+
+    for(int i = 0; i < 4; ++i) { pipeline.push(i); }
+}   // TEST destroy_while_full
+
+TEST( Test_Pipeline, close_unblocks_producer )
+{
+    // nobody pops the results, so the producer blocks
+    auto pipeline = asynchronous::Pipeline<int>{1}
+                        .stage("identity", 1, 1, [](int a) { return a; });
+
+    std::atomic_int pushed{0};
+    std::thread producer([&pipeline, &pushed]
+            {
+                while(pipeline.push(pushed.load())) { ++pushed; }
+            });
+
+    std::this_thread::sleep_for(ms(10));
+    pipeline.close();
+    producer.join();
+    EXPECT_LT(0, pushed.load());
+    EXPECT_FALSE(pipeline.push(0));
+}   // TEST close_unblocks_producer
+
+TEST( Test_Pipeline, ordered_window )
+{
+    asynchronous::latch gate(1);
+    auto pipeline = asynchronous::Pipeline<int>{}
+                        .stage("slowFirst", 4, 2, [&gate](int a)
+                               {
+                                   if (a == 0) { gate.wait(); }
+                                   return a;
+                               }, asynchronous::StageOrder::ordered);
+
+    std::atomic_int pushed{0};
+    std::thread producer([&pipeline, &pushed]
+            {
+                for(int i = 0; i < 20; ++i)
+                {
+                    EXPECT_TRUE(pipeline.push(i));
+                    ++pushed;
+                }
+                pipeline.close();
+            });
+
+    // the producer can not get more than the capacity ahead of the value 0
+    std::this_thread::sleep_for(ms(20));
+    EXPECT_EQ(2, pushed.load());
+
+    gate.count_down();
+    int expected = 0;
+    while(auto r = pipeline.pop()) { EXPECT_EQ(expected++, r.value); }
+    producer.join();
+    EXPECT_EQ(20, expected);
+}   // TEST ordered_window
+
+TEST( Test_Pipeline, zeroThreads )
+{
+    EXPECT_THROW(asynchronous::Pipeline<int>{}.stage("none", 0, 1, [](int a) { return a; }),
+                 std::invalid_argument);
+
+    // the failed stage leaves the pipeline untouched
+    asynchronous::Pipeline<int> pipeline{2};
+    EXPECT_THROW(std::move(pipeline).stage("none", 0, 1, [](int a) { return a; }),
+                 std::invalid_argument);
+    auto doubled = std::move(pipeline).stage("double", 1, 2, [](int a) { return 2 * a; });
+
+    EXPECT_TRUE(doubled.push(21));
+    doubled.close();
+    auto r = doubled.pop();
+    ASSERT_TRUE(r);
+    EXPECT_EQ(42, r.value);
+    EXPECT_FALSE(doubled.pop());
+    EXPECT_EQ(1u, doubled.getStats().size());
+}   // TEST zeroThreads
+
+//******************************************************************************
+// EOF
+//******************************************************************************
@@ -24,7 +24,9 @@
 #include "asynchronous/cappedqueue.hpp"
 #include "asynchronous/latch.hpp"
 
+#include <atomic>
 #include <string>
+#include <vector>
 #include <memory>
 #include <future>
 #include <sstream>
@@ -279,6 +281,94 @@ TEST(Test_Queue, unique_ptr)
     EXPECT_EQ( "World", *p2);
 }
 
+/**
+ * push_wait blocks instead of dropping the value
+ */
+TEST(Test_Queue, push_wait)
+{
+    using queue_t = asynchronous::SharedQueue<int>;
+
+    queue_t q;
+    q->setCapacity(2);
+
+    EXPECT_TRUE(q->push_wait(1));
+    EXPECT_TRUE(q->push_wait(2));
+    EXPECT_TRUE(q->full());
+
+    std::atomic_bool pushed{false};
+    std::thread producer([&]()
+            {
+                EXPECT_TRUE(q->push_wait(3));
+                pushed = true;
+                EXPECT_FALSE(q->push_wait(4));  // finished while waiting
+            });
+
+    std::this_thread::sleep_for(ms(10));
+    EXPECT_FALSE(pushed);
+
+    EXPECT_EQ(1, q->pop().value);
+    while(q->size() < 2) { std::this_thread::yield(); }
+    EXPECT_EQ(2u, q->getMaxQueueSize());
+
+    q->notifyToFinish();
+    producer.join();
+
+    EXPECT_TRUE(pushed);
+    EXPECT_EQ(1u, q->getDroppedItemCount());
+    EXPECT_EQ(2, q->pop().value);
+    EXPECT_EQ(3, q->pop().value);
+    EXPECT_FALSE(q->pop());
+}
+
+//------------------------------------------------------------------------------
+TEST(Test_Queue, deadline)
+{
+    using queue_t = asynchronous::SharedQueue<std::string>;
+    using clock_t = queue_t::state_t::clock_t;
+
+    queue_t q;
+    const auto past = clock_t::now() - ms(1);
+    const auto future = clock_t::now() + std::chrono::hours(1);
+
+    EXPECT_TRUE(q->push_with_deadline(past, "expired"));
+    EXPECT_TRUE(q->push_with_deadline(future, "in time"));
+    EXPECT_TRUE(q->push_with_deadline(past, "expired too"));
+    EXPECT_TRUE(q->push("no deadline"));
+
+    EXPECT_EQ("in time", q->try_pop().value);
+    EXPECT_EQ(1u, q->getExpiredItemCount());
+    EXPECT_EQ("no deadline", q->pop().value);
+    EXPECT_EQ(2u, q->getExpiredItemCount());
+    EXPECT_EQ(0u, q->getDroppedItemCount());
+
+    // a queue with expired items only is empty
+    EXPECT_TRUE(q->push_with_deadline(past, "expired"));
+    EXPECT_FALSE(q->empty());
+    EXPECT_EQ(asynchronous::PopState<queue_t>::timeout, q->pop_wait_for(ms(1)).state);
+    EXPECT_EQ(3u, q->getExpiredItemCount());
+}
+
+//------------------------------------------------------------------------------
+TEST(Test_Queue, deadline_callback)
+{
+    using queue_t = asynchronous::SharedCappedQueue<std::unique_ptr<int>, 2>;
+    using clock_t = queue_t::state_t::clock_t;
+
+    queue_t q;
+    std::vector<int> expired;
+    q->setExpiryCallback([&expired](std::unique_ptr<int> p) { expired.push_back(*p); });
+
+    EXPECT_TRUE(q->push_with_deadline(clock_t::now() - ms(1), new int(1)));
+    EXPECT_TRUE(q->push_with_deadline(clock_t::now() - ms(1), new int(2)));
+    EXPECT_TRUE(q->full());
+
+    // the expired items make room for new ones
+    EXPECT_TRUE(q->push(new int(3)));
+    EXPECT_EQ((std::vector<int>{1, 2}), expired);
+    EXPECT_EQ(2u, q->getExpiredItemCount());
+    EXPECT_EQ(3, *q->pop().value);
+}
+
 //******************************************************************************
 // EOF
 //******************************************************************************
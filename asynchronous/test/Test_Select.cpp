@@ -0,0 +1,223 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/select.hpp"
+#include "asynchronous/cappedqueue.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+using ms = std::chrono::milliseconds;
+
+using IntQueue = asynchronous::SharedCappedQueue<int, 100>;
+using StringQueue = asynchronous::SharedCappedQueue<std::string, 100>;
+
+//******************************************************************************
+TEST( Test_Select, one_shot )
+{
+    IntQueue q1;
+    StringQueue q2;
+
+    q2->push("hello");
+    EXPECT_EQ(1u, asynchronous::select(q1, q2));
+
+    q1->push(1);
+    EXPECT_EQ(0u, asynchronous::select(q1, q2));   // ordered: the first one wins
+
+    EXPECT_EQ(1, q1->try_pop().value);
+    EXPECT_EQ("hello", q2->try_pop().value);
+}   // TEST one_shot
+
+//------------------------------------------------------------------------------
+TEST( Test_Select, blocks )
+{
+    IntQueue q1;
+    StringQueue q2;
+    asynchronous::Selector selector(q1, q2);
+    EXPECT_EQ(2u, selector.size());
+
+    EXPECT_EQ(asynchronous::Selector::timeout, selector.select_for(ms(1)));
+
+    std::thread producer([q2]() mutable
+            {
+                std::this_thread::sleep_for(ms(10));
+                q2->push("late");
+            });
+
+    EXPECT_EQ(1u, selector.select());
+    EXPECT_EQ("late", q2->try_pop().value);
+    producer.join();
+}   // TEST blocks
+
+//------------------------------------------------------------------------------
+TEST( Test_Select, notify_all_with_lock )
+{
+    IntQueue q1;
+    asynchronous::Selector selector(q1);
+
+    std::thread producer([q1]() mutable
+            {
+                std::this_thread::sleep_for(ms(10));
+                auto l = q1->getLock();
+                q1->push_no_notify(l, 1);
+                q1->push_no_notify(l, 2);
+                q1->notify_all(l);      // notify_all() would take the lock again
+            });
+
+    EXPECT_EQ(0u, selector.select());
+    producer.join();
+    EXPECT_EQ(1, q1->try_pop().value);
+}   // TEST notify_all_with_lock
+
+//------------------------------------------------------------------------------
+TEST( Test_Select, round_robin )
+{
+    IntQueue q1;
+    IntQueue q2;
+    IntQueue q3;
+    for(int i = 0; i < 3; ++i)
+    {
+        q1->push(i);
+        q2->push(i);
+        q3->push(i);
+    }
+
+    asynchronous::Selector ordered(asynchronous::Fairness::ordered, q1, q2, q3);
+    EXPECT_EQ(0u, ordered.select());
+    EXPECT_EQ(0u, ordered.select());    // not popped, so still ready
+
+    asynchronous::Selector fair(asynchronous::Fairness::roundRobin, q1, q2, q3);
+    std::vector<size_t> order;
+    for(int i = 0; i < 6; ++i)
+    {
+        auto index = fair.select();
+        order.push_back(index);
+        IntQueue* queues[] = { &q1, &q2, &q3 };
+        EXPECT_TRUE((*queues[index])->try_pop());
+    }
+    EXPECT_EQ((std::vector<size_t>{0, 1, 2, 0, 1, 2}), order);
+}   // TEST round_robin
+
+//------------------------------------------------------------------------------
+TEST( Test_Select, finished )
+{
+    auto q1 = std::make_unique<IntQueue>();
+    auto q2 = std::make_unique<IntQueue>();
+    auto r2 = q2->as_reader();
+
+    asynchronous::Selector selector(*q1, *q2);
+
+    (*q2)->push(2);
+    q2.reset();     // finished, but still has a value
+
+    EXPECT_EQ(1u, selector.select());
+    EXPECT_EQ(2, r2->try_pop().value);
+    EXPECT_EQ(1u, selector.select());   // now finished, reported once
+
+    std::thread finisher([&q1]()
+            {
+                std::this_thread::sleep_for(ms(10));
+                q1.reset();
+            });
+    EXPECT_EQ(0u, selector.select());
+    finisher.join();
+
+    EXPECT_EQ(asynchronous::Selector::finished, selector.select());
+}   // TEST finished
+
+//------------------------------------------------------------------------------
+TEST( Test_Select, consumer )
+{
+    constexpr int count = 1000;
+    IntQueue q1;
+    IntQueue q2;
+
+    asynchronous::Selector selector(asynchronous::Fairness::roundRobin, q1.as_reader(), q2.as_reader());
+    auto r1 = q1.as_reader();
+    auto r2 = q2.as_reader();
+
+    std::thread p1([w = std::move(q1)]() mutable { for(int i = 1; i <= count; ++i) { w->push_wait(i); } });
+    std::thread p2([w = std::move(q2)]() mutable { for(int i = 1; i <= count; ++i) { w->push_wait(-i); } });
+
+    long long sum1 = 0;
+    long long sum2 = 0;
+    for(auto i = selector.select(); i != asynchronous::Selector::finished; i = selector.select())
+    {
+        if (i == 0) { sum1 += r1->try_pop().value; }
+        else        { sum2 += r2->try_pop().value; }
+    }
+
+    p1.join();
+    p2.join();
+    EXPECT_EQ(count * (count + 1) / 2, sum1);
+    EXPECT_EQ(-count * (count + 1) / 2, sum2);
+}   // TEST consumer
+
+//------------------------------------------------------------------------------
+template<typename WAIT>
+static std::chrono::nanoseconds measureLatency(size_t rounds, WAIT&& wait)
+{
+    IntQueue q1;
+    IntQueue q2;
+    std::chrono::nanoseconds total{0};
+
+    for(size_t i = 0; i < rounds; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        std::thread producer([&q2]() { q2->push(1); });
+        wait(q1, q2);
+        total += std::chrono::steady_clock::now() - start;
+        producer.join();
+        q2->try_pop();
+    }
+    return total / rounds;
+}
+
+// NOTE: this is a benchmark, run it with --gtest_also_run_disabled_tests
+TEST( Test_Select, DISABLED_benchmark )
+{
+    constexpr size_t rounds = 1000;
+
+    auto selected = measureLatency(rounds, [](IntQueue& q1, IntQueue& q2) { asynchronous::select(q1, q2); });
+    auto polled = measureLatency(rounds, [](IntQueue& q1, IntQueue& q2)
+            {
+                while(true)
+                {
+                    if (q1->pop_wait_for(ms(1)).state != asynchronous::PopState<IntQueue>::timeout) { return; }
+                    if (not q2->empty()) { return; }
+                }
+            });
+
+    std::cout << "latency per item: select " << selected.count()
+              << "ns, polling with pop_wait_for(1ms) " << polled.count() << "ns" << std::endl;
+}   // TEST DISABLED_benchmark
+
+//******************************************************************************
+// EOF
+//******************************************************************************
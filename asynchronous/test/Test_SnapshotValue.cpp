@@ -0,0 +1,176 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/snapshotvalue.hpp"
+#include "asynchronous/synchronizedvalue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+namespace {
+//******************************************************************************
+/**
+ * detects the use of a deleted value
+ */
+struct Checked
+{
+    static std::atomic_int alive;
+
+    static constexpr unsigned int valid = 0xC0FFEE;
+    unsigned int magic = valid;
+    int value = 0;
+
+    explicit Checked(int v) : value(v) { ++alive; }
+    Checked(const Checked& other) : value(other.value) { ++alive; }
+    ~Checked() { magic = 0; --alive; }
+};
+
+std::atomic_int Checked::alive{0};
+
+//******************************************************************************
+}  // namespace
+
+//******************************************************************************
+TEST( Test_SnapshotValue, read_and_update )
+{
+    using map_t = std::map<std::string, int>;
+    asynchronous::SnapshotValue<map_t> routes{ map_t{ {"a", 1} } };
+
+    auto before = routes.read();
+    routes.update([](map_t& m) { m["b"] = 2; });
+
+    EXPECT_EQ(1u, before->size());          // the old snapshot is unchanged
+    EXPECT_EQ(2u, routes.read()->size());
+    EXPECT_EQ(2, routes.getValue().at("b"));
+}   // TEST read_and_update
+
+TEST( Test_SnapshotValue, reclaim )
+{
+    {
+        asynchronous::SnapshotValue<Checked> value(1);
+        EXPECT_EQ(1, Checked::alive.load());
+
+        {
+            auto snapshot = value.read();
+            value.setValue(Checked(2));
+            EXPECT_EQ(1u, value.getRetiredCount());     // still in use by the snapshot
+            EXPECT_EQ(1, snapshot->value);
+            EXPECT_EQ(Checked::valid, snapshot->magic);
+        }
+
+        value.synchronize();
+        EXPECT_EQ(0u, value.getRetiredCount());
+        EXPECT_EQ(1, Checked::alive.load());
+        EXPECT_EQ(2, value.read()->value);
+    }
+    EXPECT_EQ(0, Checked::alive.load());
+}   // TEST reclaim
+
+TEST( Test_SnapshotValue, concurrent )
+{
+    constexpr int updates = 2000;
+    asynchronous::SnapshotValue<Checked> value(0);
+    std::atomic_bool done{false};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r)
+    {
+        readers.emplace_back([&]()
+            {
+                int last = 0;
+                while (not done)
+                {
+                    auto snapshot = value.read();
+                    auto nested = value.read();
+                    ASSERT_EQ(Checked::valid, snapshot->magic);
+                    ASSERT_LE(last, snapshot->value);
+                    ASSERT_LE(snapshot->value, nested->value);
+                    last = snapshot->value;
+                }
+            });
+    }
+
+    for (int i = 1; i <= updates; ++i)
+    { value.update([i](Checked& c) { c.value = i; }); }
+    done = true;
+    for (auto& t : readers) { t.join(); }
+
+    value.synchronize();
+    EXPECT_EQ(updates, value.read()->value);
+    EXPECT_EQ(1, Checked::alive.load());
+}   // TEST concurrent
+
+//------------------------------------------------------------------------------
+template<typename READ>
+static double measureReads(size_t readerCount, READ read)
+{
+    std::atomic_bool done{false};
+    std::atomic_size_t reads{0};
+
+    std::vector<std::thread> readers;
+    for (size_t r = 0; r < readerCount; ++r)
+    {
+        readers.emplace_back([&]()
+            {
+                size_t count = 0;
+                while (not done) { count += read(); }
+                reads += count;
+            });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{200});
+    done = true;
+    for (auto& t : readers) { t.join(); }
+    return static_cast<double>(reads.load()) / 0.2;
+}
+
+// NOTE: this is a benchmark, run it with --gtest_also_run_disabled_tests
+TEST( Test_SnapshotValue, DISABLED_benchmark )
+{
+    using map_t = std::map<int, int>;
+    map_t table{ {1, 1}, {2, 1}, {3, 1} };
+
+    asynchronous::SnapshotValue<map_t> snapshot(table);
+    asynchronous::SynchronizedValue<map_t, asynchronous::LockedRead, asynchronous::SharedLock> shared(table);
+    const auto& constShared = shared;
+
+    for (size_t readers = 1; readers <= 64; readers *= 2)
+    {
+        auto s = measureReads(readers, [&]() { return snapshot.read()->count(2); });
+        auto l = measureReads(readers, [&]() { return constShared.getUpdater()->count(2); });
+        std::cout << readers << " readers, lookups/s: snapshot " << s
+                  << ", shared lock " << l << std::endl;
+    }
+}   // TEST DISABLED_benchmark
+
+//******************************************************************************
+// EOF
+//******************************************************************************
@@ -0,0 +1,209 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/spillingqueue.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+namespace {
+//******************************************************************************
+using ms = std::chrono::milliseconds;
+
+/**
+ * a directory for the segment files, removed at the end
+ */
+struct SpillDirectory
+{
+    std::filesystem::path path;
+
+    SpillDirectory() :
+        path(std::filesystem::temp_directory_path() /
+             ("Test_SpillingQueue-" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count())))
+    { std::filesystem::create_directories(path); }
+
+    ~SpillDirectory() { std::filesystem::remove_all(path); }
+
+    size_t countFiles() const
+    {
+        size_t count = 0;
+        for(const auto& entry : std::filesystem::directory_iterator(path)) { (void)entry; ++count; }
+        return count;
+    }
+};
+
+struct Point
+{
+    std::string name;
+    int x = 0;
+    int y = 0;
+};
+
+//******************************************************************************
+}  // namespace
+
+/**
+ * a serializer for a non trivial type
+ */
+template<>
+struct asynchronous::SpillSerializer<Point>
+{
+    static size_t size(const Point& p) { return 2 * sizeof(int) + p.name.size(); }
+    static void write(const Point& p, char* dest)
+    {
+        std::memcpy(dest, &p.x, sizeof(int));
+        std::memcpy(dest + sizeof(int), &p.y, sizeof(int));
+        std::memcpy(dest + 2 * sizeof(int), p.name.data(), p.name.size());
+    }
+    static Point read(const char* src, size_t size)
+    {
+        Point p;
+        std::memcpy(&p.x, src, sizeof(int));
+        std::memcpy(&p.y, src + sizeof(int), sizeof(int));
+        p.name.assign(src + 2 * sizeof(int), size - 2 * sizeof(int));
+        return p;
+    }
+};
+
+//******************************************************************************
+TEST( Test_SpillingQueue, spill_and_read_back )
+{
+    SpillDirectory dir;
+    using queue_t = asynchronous::SharedSpillingQueue<int>;
+    queue_t q(std::make_shared<queue_t::state_t>(4, dir.path.string(), 64));
+
+    for(int i = 0; i < 40; ++i) { EXPECT_TRUE(q->push(i)); }
+
+    EXPECT_EQ(40u, q->size());
+    EXPECT_EQ(36u, q->getSpilledSize());
+    EXPECT_EQ(36u, q->getSpilledItemCount());
+    EXPECT_EQ(q->getLiveSegmentCount(), dir.countFiles());
+    EXPECT_GT(q->getSegmentCount(), 1u);
+
+    for(int i = 0; i < 20; ++i) { EXPECT_EQ(i, q->pop().value); }
+    EXPECT_EQ(q->getLiveSegmentCount(), dir.countFiles());   // the consumed ones are deleted
+
+    EXPECT_TRUE(q->push(40));   // goes to disk, to keep the order
+    for(int i = 20; i <= 40; ++i) { EXPECT_EQ(i, q->pop().value); }
+
+    EXPECT_TRUE(q->empty());
+    EXPECT_EQ(0u, q->getLiveSegmentCount());
+    EXPECT_EQ(0u, dir.countFiles());
+    EXPECT_EQ(asynchronous::PopState<queue_t>::timeout, q->pop_wait_for(ms(1)).state);
+
+    EXPECT_TRUE(q->push(41));   // back to memory
+    EXPECT_EQ(37u, q->getSpilledItemCount());
+}   // TEST spill_and_read_back
+
+//------------------------------------------------------------------------------
+TEST( Test_SpillingQueue, serializer )
+{
+    SpillDirectory dir;
+    using queue_t = asynchronous::SharedSpillingQueue<std::string>;
+    queue_t q(std::make_shared<queue_t::state_t>(1, dir.path.string(), 32));
+
+    q->push("in memory");
+    q->push("");
+    q->push(100, 'x');  // larger than a segment, gets its own
+    q->push("on disk");
+
+    EXPECT_EQ("in memory", q->pop().value);
+    EXPECT_EQ("", q->pop().value);
+    EXPECT_EQ(std::string(100, 'x'), q->pop().value);
+    EXPECT_EQ("on disk", q->pop().value);
+
+    using point_queue_t = asynchronous::SharedSpillingQueue<Point>;
+    point_queue_t points(std::make_shared<point_queue_t::state_t>(0, dir.path.string()));
+    points->push(Point{"a", 1, 2});
+    auto p = points->pop().value;
+    EXPECT_EQ("a", p.name);
+    EXPECT_EQ(1, p.x);
+    EXPECT_EQ(2, p.y);
+    EXPECT_EQ(1u, points->getSpilledItemCount());
+}   // TEST serializer
+
+//------------------------------------------------------------------------------
+TEST( Test_SpillingQueue, finish )
+{
+    SpillDirectory dir;
+    using state_t = asynchronous::basic_spilling_queue<int>;
+    auto writer = std::make_unique< asynchronous::SharedSpillingQueue<int> >(std::make_shared<state_t>(1, dir.path.string()));
+    asynchronous::SpillingQueue<int> reader = writer->as_reader();
+
+    (*writer)->push(1);
+    (*writer)->push(2);
+    writer.reset();
+
+    EXPECT_FALSE(reader->push(3));
+    EXPECT_EQ(1u, reader->getDroppedItemCount());
+    EXPECT_EQ(1, reader->pop().value);
+    EXPECT_EQ(2, reader->pop().value);
+    EXPECT_FALSE(reader->pop());
+
+    {
+        asynchronous::SharedSpillingQueue<int> q(std::make_shared<state_t>(0, dir.path.string()));
+        q->push(1);
+        EXPECT_EQ(1u, dir.countFiles());
+    }
+    EXPECT_EQ(0u, dir.countFiles());    // the destructor deletes the remaining segments
+}   // TEST finish
+
+//------------------------------------------------------------------------------
+TEST( Test_SpillingQueue, threads )
+{
+    SpillDirectory dir;
+    constexpr int count = 100000;
+    using state_t = asynchronous::basic_spilling_queue<int>;
+    auto writer = std::make_unique< asynchronous::SharedSpillingQueue<int> >(std::make_shared<state_t>(100, dir.path.string(), 4096));
+    asynchronous::SpillingQueue<int> reader = writer->as_reader();
+
+    std::thread producer([&writer]()
+            {
+                for(int i = 0; i < count; ++i) { (*writer)->push(i); }
+                writer.reset();
+            });
+
+    int expected = 0;
+    while(auto r = reader->pop())
+    {
+        ASSERT_EQ(expected, r.value);
+        ++expected;
+    }
+    producer.join();
+
+    EXPECT_EQ(count, expected);
+    EXPECT_EQ(0u, dir.countFiles());
+}   // TEST threads
+
+//******************************************************************************
+// EOF
+//******************************************************************************
@@ -17,9 +17,15 @@
 
 //******************************************************************************
 #include "asynchronous/synchronizedvalue.hpp"
+#include "asynchronous/waiter.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <map>
+#include <thread>
+#include <vector>
 
 //------------------------------------------------------------------------------
 #include <gtest/gtest.h>
@@ -117,6 +123,179 @@ TEST(Test_SynchronizedValue, Map)
     ASSERT_EQ(Map->size(), 4u);
 }
 
+//------------------------------------------------------------------------------
+struct Pair
+{
+    std::uint64_t first;
+    std::uint64_t second;
+};
+
+TEST(Test_SynchronizedValue, SeqLock)
+{
+    asynchronous::SynchronizedValue<Pair, asynchronous::SeqLockRead> value(Pair{0, 0});
+    std::atomic_bool done{false};
+
+    std::thread writer([&]()
+        {
+            for (std::uint64_t i = 1; i <= 100000; ++i)
+            {
+                auto updater = value.getUpdater();
+                updater->first = i;
+                updater->second = i;
+            }
+            done = true;
+        });
+
+    std::uint64_t last = 0;
+    while (not done)
+    {
+        auto copy = value.getValue();
+        ASSERT_EQ(copy.first, copy.second);     // never torn
+        ASSERT_LE(last, copy.first);            // never older than before
+        last = copy.first;
+    }
+    writer.join();
+
+    EXPECT_EQ(100000u, value.getValue().first);
+}
+
+TEST(Test_SynchronizedValue, SeqLockWaiter)
+{
+    asynchronous::WaiterForAtLeast<int, asynchronous::WakeUp::broadcast,
+                                   asynchronous::SeqLockRead> w(0);
+
+    w += 3;
+    EXPECT_EQ(3, w.getValue());
+
+    w.setValue(5);
+    EXPECT_EQ(5, w.getValue());
+    EXPECT_TRUE(w.try_wait(5));
+}
+
+//------------------------------------------------------------------------------
+template<typename LOCK>
+static void testSharedAccess()
+{
+    asynchronous::SynchronizedValue<Tracer, asynchronous::LockedRead, LOCK> a(5);
+    const auto& constA = a;
+
+    std::atomic_int inside{0};
+    auto reader = [&]()
+        {
+            auto updater = constA.getUpdater();
+            ++inside;
+            while (inside < 2) { std::this_thread::yield(); }   // both readers hold the lock
+            EXPECT_EQ(updater, Tracer( 5 ));
+        };
+
+    std::thread t1(reader);
+    std::thread t2(reader);
+    t1.join();
+    t2.join();
+
+    a->add(1);
+    EXPECT_EQ(Tracer( 6 ), a.getValue());
+}
+
+TEST(Test_SynchronizedValue, SharedLock)
+{
+    testSharedAccess<asynchronous::SharedLock>();
+    testSharedAccess<asynchronous::WriterPreferringLock>();
+}
+
+TEST(Test_SynchronizedValue, WriterPreferring)
+{
+    asynchronous::lightweight::WriterPreferringMutex mutex;
+
+    mutex.lock_shared();
+    EXPECT_TRUE(mutex.try_lock_shared());
+    mutex.unlock_shared();
+    EXPECT_FALSE(mutex.try_lock());
+
+    std::atomic_bool written{false};
+    std::thread writer([&]() { mutex.lock(); written = true; mutex.unlock(); });
+
+    // as soon as the writer waits, no new reader gets in
+    while (mutex.try_lock_shared()) { mutex.unlock_shared(); std::this_thread::yield(); }
+    EXPECT_FALSE(written);
+
+    mutex.unlock_shared();
+    writer.join();
+    EXPECT_TRUE(written);
+
+    EXPECT_TRUE(mutex.try_lock_shared());
+    mutex.unlock_shared();
+    EXPECT_TRUE(mutex.try_lock());
+    mutex.unlock();
+}
+
+//------------------------------------------------------------------------------
+template<typename VALUE, typename READ>
+static double measureReads(VALUE& value, size_t readerCount, READ read)
+{
+    std::atomic_bool done{false};
+    std::atomic_size_t reads{0};
+
+    std::thread writer([&]()
+        {
+            for (std::uint64_t i = 0; not done; ++i)
+            { value.getUpdater()->first = i; }
+        });
+
+    std::vector<std::thread> readers;
+    for (size_t r = 0; r < readerCount; ++r)
+    {
+        readers.emplace_back([&]()
+            {
+                size_t count = 0;
+                while (not done) { read(value); ++count; }
+                reads += count;
+            });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{200});
+    done = true;
+    for (auto& t : readers) { t.join(); }
+    writer.join();
+
+    return static_cast<double>(reads.load()) / 0.2;
+}
+
+// NOTE: this is a benchmark, run it with --gtest_also_run_disabled_tests
+TEST(Test_SynchronizedValue, DISABLED_benchmark_seqlock)
+{
+    for (size_t readers = 1; readers <= 64; readers *= 2)
+    {
+        asynchronous::SynchronizedValue<Pair> locked(Pair{0, 0});
+        asynchronous::SynchronizedValue<Pair, asynchronous::SeqLockRead> seqlock(Pair{0, 0});
+
+        auto getValue = [](const auto& value) { return value.getValue(); };
+
+        std::cout << readers << " readers, reads/s: locked " << measureReads(locked, readers, getValue)
+                  << ", seqlock " << measureReads(seqlock, readers, getValue) << std::endl;
+    }
+}
+
+// NOTE: this is a benchmark, run it with --gtest_also_run_disabled_tests
+TEST(Test_SynchronizedValue, DISABLED_benchmark_shared)
+{
+    using namespace asynchronous;
+
+    for (size_t readers = 1; readers <= 64; readers *= 2)
+    {
+        SynchronizedValue<Pair> exclusive(Pair{0, 0});
+        SynchronizedValue<Pair, LockedRead, SharedLock> shared(Pair{0, 0});
+        SynchronizedValue<Pair, LockedRead, WriterPreferringLock> writerPreferring(Pair{0, 0});
+
+        auto constAccess = [](const auto& value) { return value.getUpdater()->first; };
+
+        std::cout << readers << " readers, reads/s: exclusive " << measureReads(exclusive, readers, constAccess)
+                  << ", shared " << measureReads(shared, readers, constAccess)
+                  << ", writer preferring " << measureReads(writerPreferring, readers, constAccess)
+                  << std::endl;
+    }
+}
+
 //******************************************************************************
 // EOF
 //******************************************************************************
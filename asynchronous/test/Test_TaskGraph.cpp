@@ -0,0 +1,234 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/taskgraph.hpp"
+#include "asynchronous/lightweight/latch.hpp"
+#include "asynchronous/work_stealing_pool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+using ms = std::chrono::milliseconds;
+
+//******************************************************************************
+TEST( Test_TaskGraph, diamond )
+{
+    std::mutex mutex;
+    std::vector<std::string> order;
+    auto task = [&](std::string name)
+    {
+        return [&mutex, &order, name]()
+        {
+            std::lock_guard<std::mutex> lck(mutex);
+            order.push_back(name);
+        };
+    };
+
+    asynchronous::TaskGraph graph;
+    auto a = graph.add(task("a"), "a");
+    auto b = graph.add(task("b"), "b");
+    auto c = graph.add(task("c"), "c");
+    auto d = graph.add(task("d"), "d");
+    graph.precede(a, b);
+    graph.precede(a, c);
+    graph.precede(b, d);
+    graph.precede(c, d);
+    EXPECT_EQ(4u, graph.size());
+
+    asynchronous::InlineExecutor executor;
+    graph.run(executor).get();
+
+    ASSERT_EQ(4u, order.size());
+    EXPECT_EQ("a", order.front());
+    EXPECT_EQ("d", order.back());
+
+    // the graph can run again
+    order.clear();
+    asynchronous::WorkStealingPool pool(4);
+    asynchronous::wait(pool, graph.run(pool));
+    ASSERT_EQ(4u, order.size());
+    EXPECT_EQ("a", order.front());
+    EXPECT_EQ("d", order.back());
+}   // TEST diamond
+
+//------------------------------------------------------------------------------
+TEST( Test_TaskGraph, many_nodes )
+{
+    constexpr size_t layers = 100;
+    constexpr size_t width = 100;
+
+    asynchronous::TaskGraph graph;
+    std::vector<std::atomic<size_t>> done(layers);
+    std::atomic<bool> ordered{true};
+
+    for(size_t layer = 0; layer < layers; ++layer)
+    {
+        for(size_t i = 0; i < width; ++i)
+        {
+            auto node = graph.add([&done, &ordered, layer]()
+                    {
+                        if ((layer > 0) && (done[layer - 1] != width)) { ordered = false; }
+                        ++done[layer];
+                    });
+            if (layer == 0) { continue; }
+
+            // every node depends on all nodes of the previous layer
+            for(size_t p = 0; p < width; ++p) { graph.precede(node - width - i + p, node); }
+        }
+    }
+
+    asynchronous::WorkStealingPool pool(4);
+    asynchronous::wait(pool, graph.run(pool));
+
+    EXPECT_TRUE(ordered);
+    for(const auto& count : done) { EXPECT_EQ(width, count); }
+}   // TEST many_nodes
+
+//------------------------------------------------------------------------------
+TEST( Test_TaskGraph, errors )
+{
+    asynchronous::TaskGraph graph;
+    auto a = graph.add([]() {});
+    auto b = graph.add([]() { throw std::runtime_error("b failed"); });
+    std::atomic<bool> cRan{false};
+    auto c = graph.add([&cRan]() { cRan = true; });
+    graph.precede(a, b);
+    graph.precede(b, c);
+
+    EXPECT_THROW(graph.precede(a, a), std::invalid_argument);
+    EXPECT_THROW(graph.precede(a, 42), std::invalid_argument);
+
+    asynchronous::ThreadExecutor executor;
+    auto future = graph.run(executor);
+    EXPECT_THROW(future.get(), std::runtime_error);
+    EXPECT_FALSE(cRan);     // skipped after the failure
+
+    graph.precede(c, a);
+    EXPECT_THROW(graph.run(executor), std::logic_error);
+
+    asynchronous::TaskGraph empty;
+    empty.run(executor).get();
+}   // TEST errors
+
+//------------------------------------------------------------------------------
+TEST( Test_TaskGraph, timings )
+{
+    asynchronous::TaskGraph graph;
+    auto sleep = [](ms duration) { return [duration]() { std::this_thread::sleep_for(duration); }; };
+
+    auto start = graph.add(sleep(ms(1)), "start");
+    auto fast = graph.add(sleep(ms(1)), "fast");
+    auto slow = graph.add(sleep(ms(20)), "slow \"one\"");
+    auto end = graph.add(sleep(ms(1)), "end");
+    graph.precede(start, fast);
+    graph.precede(start, slow);
+    graph.precede(fast, end);
+    graph.precede(slow, end);
+
+    asynchronous::WorkStealingPool pool(2);
+    asynchronous::wait(pool, graph.run(pool));
+
+    auto timings = graph.getTimings();
+    ASSERT_EQ(4u, timings.size());
+    EXPECT_EQ("start", timings.front().name);
+    EXPECT_EQ("end", timings.back().name);
+    EXPECT_GE(timings[0].duration, ms(1));
+    for(size_t i = 1; i < timings.size(); ++i) { EXPECT_LE(timings[i - 1].start, timings[i].start); }
+
+    EXPECT_EQ((std::vector<asynchronous::TaskGraph::node_t>{start, slow, end}), graph.getCriticalPath());
+
+    std::ostringstream s;
+    graph.writeTimings(s);
+    EXPECT_EQ(0u, s.str().find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, s.str().find("\"name\":\"slow \\\"one\\\"\",\"ph\":\"X\""));
+}   // TEST timings
+
+//------------------------------------------------------------------------------
+// NOTE: this is a benchmark, run it with --gtest_also_run_disabled_tests
+TEST( Test_TaskGraph, DISABLED_benchmark )
+{
+    constexpr size_t layers = 100;
+    constexpr size_t width = 100;
+    const auto work = std::chrono::microseconds(20);
+
+    // the work of a node depends on its position, so the waves are unbalanced
+    auto job = [work](size_t layer, size_t i)
+    {
+        return [work, layer, i]()
+        {
+            auto end = std::chrono::steady_clock::now() + work * (1 + (layer + i) % 4);
+            while(std::chrono::steady_clock::now() < end) {}
+        };
+    };
+
+    asynchronous::WorkStealingPool pool;
+
+    // waves: every layer waits for the previous one
+    auto start = std::chrono::steady_clock::now();
+    for(size_t layer = 0; layer < layers; ++layer)
+    {
+        asynchronous::lightweight::latch done(width);
+        for(size_t i = 0; i < width; ++i)
+        {
+            pool.execute([&done, task = job(layer, i)]() { task(); done.count_down(); });
+        }
+        while(not done.try_wait()) { if (not pool.runPendingJob()) { std::this_thread::yield(); } }
+    }
+    auto waves = std::chrono::steady_clock::now() - start;
+
+    // graph: every node depends on two nodes of the previous layer
+    asynchronous::TaskGraph graph;
+    for(size_t layer = 0; layer < layers; ++layer)
+    {
+        for(size_t i = 0; i < width; ++i)
+        {
+            auto node = graph.add(job(layer, i));
+            if (layer == 0) { continue; }
+            graph.precede(node - width, node);
+            graph.precede(node - width - i + (i + 1) % width, node);
+        }
+    }
+
+    start = std::chrono::steady_clock::now();
+    asynchronous::wait(pool, graph.run(pool));
+    auto dag = std::chrono::steady_clock::now() - start;
+
+    std::cout << layers * width << " tasks: waves "
+              << std::chrono::duration_cast<ms>(waves).count() << "ms, TaskGraph "
+              << std::chrono::duration_cast<ms>(dag).count() << "ms, critical path of "
+              << graph.getCriticalPath().size() << " tasks" << std::endl;
+}   // TEST DISABLED_benchmark
+
+//******************************************************************************
+// EOF
+//******************************************************************************
@@ -19,12 +19,16 @@
 // Created on: Sep 6, 2018
 //     Author: oelsnerc
 //******************************************************************************
+#include "asynchronous/executor.hpp"
 #include "asynchronous/waiter.hpp"
 
 #include <thread>
 #include <future>
 #include <vector>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
 
 //------------------------------------------------------------------------------
 #include <gtest/gtest.h>
@@ -129,6 +133,28 @@ TEST(Test_Waiter, updater)
     EXPECT_EQ(count, w->size());
 }
 
+TEST(Test_Waiter, updater_move_assign)
+{
+    using waiter_t = asynchronous::WaiterForAtLeast<int, asynchronous::WakeUp::broadcast,
+                                                    asynchronous::SeqLockRead>;
+    waiter_t w1(0);
+    waiter_t w2(0);
+    int fired = 0;
+    w1.when_ready(asynchronous::InlineExecutor{}, [&fired]() { ++fired; }, 5);
+
+    auto updater = w1.getUpdater();
+    *updater = 5;
+    updater = w2.getUpdater();      // finishes the write on w1
+    *updater = 7;
+
+    EXPECT_EQ(1, fired);
+    EXPECT_EQ(5, w1.getValue());
+    EXPECT_TRUE(w1.try_wait(5));
+
+    updater = w1.getUpdater();
+    EXPECT_EQ(7, w2.getValue());
+}
+
 
 TEST( Test_Waiter, timeout )
 {
@@ -140,6 +166,127 @@ TEST( Test_Waiter, timeout )
     EXPECT_TRUE( waiterForZero.wait_for(std::chrono::microseconds{1}) );
 }   // TEST timeout
 
+//------------------------------------------------------------------------------
+TEST( Test_Waiter, targeted )
+{
+    constexpr size_t count = 8;
+    auto w = asynchronous::createTargetedWaiterForAtLeast(size_t{0});
+    std::atomic_size_t woken{0};
+
+    std::vector<std::future<void>> threads;
+    for(size_t i = 1; i <= count; ++i)
+    {
+        threads.emplace_back(run([&,i]()
+                {
+                    w.wait(i);
+                    EXPECT_LE(i, w.getValue());
+                    ++woken;
+                }));
+    }
+
+    for(size_t i = 1; i <= count; ++i)
+    {
+        w += 1;
+        while (woken < i) { std::this_thread::yield(); }
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        EXPECT_EQ(i, woken.load());     // only the waiter for i was woken up
+    }
+
+    // the asynchronous waiters only fire for their own target as well
+    struct Handle
+    {
+        std::atomic_size_t* resumed;
+        void resume() const { ++(*resumed); }
+    };
+    std::atomic_size_t fired{0};
+
+    w.when_ready(asynchronous::InlineExecutor{}, [&fired]() { ++fired; }, count + 2);
+    auto awaiter = w.async_wait(asynchronous::InlineExecutor{}, count + 1);
+    EXPECT_FALSE(awaiter.await_ready());
+    EXPECT_TRUE(awaiter.await_suspend(Handle{&fired}));
+    EXPECT_TRUE(w.try_wait(0));     // another setup of the shared predicate
+
+    w += 1;
+    EXPECT_EQ(1u, fired.load());    // only the awaiter for count+1
+    w += 1;
+    EXPECT_EQ(2u, fired.load());
+}   // TEST targeted
+
+TEST( Test_Waiter, targeted_timeout )
+{
+    auto w = asynchronous::createTargetedWaiterForAtLeast(0);
+
+    EXPECT_FALSE( w.wait_for(std::chrono::microseconds{1}, 1) );
+    EXPECT_TRUE( w.try_wait(0) );
+
+    auto f = run([&]() { w.wait(2); });
+    w += 2;
+    f.get();
+    EXPECT_TRUE( w.wait_for(std::chrono::microseconds{1}, 2) );
+}   // TEST targeted_timeout
+
+//------------------------------------------------------------------------------
+TEST( Test_Waiter, inline_storage )
+{
+    using waiter_t = asynchronous::WaiterForAtLeast<size_t, asynchronous::WakeUp::broadcast,
+                                                    asynchronous::LockedRead,
+                                                    asynchronous::InlineStorage>;
+    static_assert( alignof(waiter_t) == asynchronous::traits::cacheLineSize );
+    static_assert( sizeof(waiter_t) % asynchronous::traits::cacheLineSize == 0 );
+
+    constexpr size_t count = 1000;
+    std::vector<waiter_t> waiters(count);   // no reallocation, as they are not movable
+
+    auto f = run([&]()
+            {
+                for(auto& w : waiters) { w += 2; }
+            });
+
+    for(auto& w : waiters) { w.wait(size_t{2}); }
+    f.get();
+
+    for(size_t i = 1; i < count; ++i)
+    {
+        auto distance = reinterpret_cast<std::uintptr_t>(&waiters[i]) -
+                        reinterpret_cast<std::uintptr_t>(&waiters[i-1]);
+        ASSERT_EQ(sizeof(waiter_t), distance);
+        ASSERT_EQ(2u, waiters[i].getValue());
+    }
+}   // TEST inline_storage
+
+//------------------------------------------------------------------------------
+template<typename WAITER>
+static std::chrono::nanoseconds measureProgress(WAITER& waiter, size_t threadCount)
+{
+    std::vector<std::future<void>> threads;
+    for(size_t i = 1; i <= threadCount; ++i)
+    { threads.emplace_back(run([&waiter, i]() { waiter.wait(i); })); }
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+
+    auto start = std::chrono::steady_clock::now();
+    for(size_t i = 1; i <= threadCount; ++i) { waiter += 1; }
+    for(auto& t : threads) { t.get(); }
+    return std::chrono::steady_clock::now() - start;
+}
+
+// NOTE: this is a benchmark, run it with --gtest_also_run_disabled_tests
+TEST( Test_Waiter, DISABLED_benchmark_targeted )
+{
+    constexpr size_t threadCount = 200;
+
+    auto broadcast = asynchronous::createWaiterForAtLeast(size_t{0});
+    auto targeted = asynchronous::createTargetedWaiterForAtLeast(size_t{0});
+
+    auto b = measureProgress(broadcast, threadCount);
+    auto t = measureProgress(targeted, threadCount);
+
+    std::cout << threadCount << " waiters, broadcast: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(b).count() << "us"
+              << ", targeted: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(t).count() << "us"
+              << std::endl;
+}   // TEST DISABLED_benchmark_targeted
+
 //******************************************************************************
 // EOF
 //******************************************************************************
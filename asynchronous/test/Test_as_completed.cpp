@@ -0,0 +1,144 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/as_completed.hpp"
+#include "asynchronous/work_stealing_pool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+using ms = std::chrono::milliseconds;
+
+TEST( Test_as_completed, completion_order )
+{
+    // the first element takes longest, so it has to be the last one
+    const std::vector<int> delays = { 300, 10, 20, 30 };
+
+    auto results = asynchronous::invoke_on_each_as_completed(delays.size(), delays, [](int delay)
+                   {
+                       std::this_thread::sleep_for(ms(delay));
+                       return delay;
+                   });
+
+    EXPECT_EQ(delays.size(), results.size());
+    EXPECT_EQ(delays.size(), results.threadCount());
+
+    std::vector<size_t> order;
+    for(auto& completed : results)
+    {
+        EXPECT_EQ(delays[completed.index], completed.get());
+        order.push_back(completed.index);
+    }
+
+    ASSERT_EQ(delays.size(), order.size());
+    EXPECT_EQ(0u, order.back());
+    EXPECT_EQ(4u, std::set<size_t>(order.begin(), order.end()).size());
+}   // TEST completion_order
+
+TEST( Test_as_completed, exception )
+{
+    std::list<int> numbers = { 1,2,3,4,5,6 };
+
+    auto results = asynchronous::invoke_on_each_as_completed(3, numbers, [](int a)
+                   {
+                       if (a % 2) { throw std::runtime_error("odd"); }
+                       return a;
+                   });
+
+    int sum = 0;
+    size_t failed = 0;
+    while(auto r = results.pop())
+    {
+        if (r.value.hasException())
+        {
+            EXPECT_THROW(r.value.get(), std::runtime_error);
+            ++failed;
+        }
+        else
+        { sum += r.value.get(); }
+    }
+
+    EXPECT_EQ(12, sum);
+    EXPECT_EQ(3u, failed);
+}   // TEST exception
+
+TEST( Test_as_completed, void_on_executor )
+{
+    asynchronous::WorkStealingPool pool(2);
+
+    std::vector<int> numbers(100, 1);
+    auto results = asynchronous::invoke_on_each_as_completed(pool, 3, asynchronous::static_chunk(7),
+                                                             numbers, [](int& a) { a += 1; });
+
+    std::set<size_t> indices;
+    for(auto& completed : results)
+    {
+        EXPECT_FALSE(completed.hasException());
+        indices.insert(completed.index);
+    }
+
+    EXPECT_EQ(numbers.size(), indices.size());
+    EXPECT_EQ(std::vector<int>(100, 2), numbers);
+}   // TEST void_on_executor
+
+TEST( Test_as_completed, abandoned )
+{
+    std::atomic_size_t calls{0};
+    {
+        auto results = asynchronous::invoke_on_each_as_completed(2, asynchronous::dynamic(1),
+                       std::vector<int>(1000, 5), [&calls](int a)
+                       {
+                           ++calls;
+                           std::this_thread::sleep_for(ms(1));
+                           return a;
+                       });
+
+        auto first = results.pop();
+        ASSERT_TRUE(first);
+        EXPECT_EQ(5, first.value.get());
+    }   // the workers stop to claim new elements here
+
+    EXPECT_GT(1000u, calls);
+}   // TEST abandoned
+
+TEST( Test_as_completed, empty )
+{
+    auto noElements = asynchronous::invoke_on_each_as_completed(4, std::vector<int>{}, [](int a) { return a; });
+    EXPECT_EQ(0u, noElements.size());
+    EXPECT_FALSE(noElements.pop());
+
+    auto noThreads = asynchronous::invoke_on_each_as_completed(0, std::vector<int>{1,2}, [](int a) { return a; });
+    EXPECT_EQ(0u, noThreads.threadCount());
+    EXPECT_TRUE(noThreads.begin() == noThreads.end());
+}   // TEST empty
+
+//******************************************************************************
+// EOF
+//******************************************************************************
@@ -0,0 +1,146 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/when_all.hpp"
+#include "asynchronous/work_stealing_pool.hpp"
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+using ms = std::chrono::milliseconds;
+
+TEST( Test_continuation, then_before_set )
+{
+    asynchronous::FutureValue<int> value;
+
+    std::thread::id continuationThread;
+    auto doubled = value.then([&continuationThread](std::future<int> ready)
+                   {
+                       continuationThread = std::this_thread::get_id();
+                       return 2 * ready.get();
+                   });
+
+    EXPECT_EQ(std::future_status::timeout, doubled->wait_for(ms(0)));
+
+    std::thread setter([&value] { value.set_value(21); });
+    const auto setterThread = setter.get_id();
+    setter.join();
+
+    EXPECT_EQ(42, doubled->get());
+    EXPECT_EQ(setterThread, continuationThread);    // inline in the setting thread
+}   // TEST then_before_set
+
+TEST( Test_continuation, then_after_set_on_executor )
+{
+    asynchronous::WorkStealingPool pool(2);
+    asynchronous::FutureValue<std::string> value;
+    value.set_value("Hello");
+
+    auto chained = value.then(pool, [](std::future<std::string> ready) { return ready.get() + " World"; })
+                        .then(pool, [](std::future<std::string> ready) { return ready.get().size(); });
+
+    EXPECT_EQ(11u, chained->get());
+    EXPECT_THROW(value.then([](std::future<std::string>) {}), std::future_error);
+}   // TEST then_after_set_on_executor
+
+TEST( Test_continuation, exception )
+{
+    asynchronous::OneTimeFutureValue<int> value;
+
+    auto result = value.then([](std::future<int> ready) { return ready.get() + 1; })
+                       .then([](std::future<int> ready)
+                             {
+                                 try { return std::to_string(ready.get()); }
+                                 catch(const std::runtime_error& e) { return std::string{e.what()}; }
+                             });
+
+    value.set_exception(std::runtime_error("failed"));
+    value.set_value(1);     // ignored
+
+    EXPECT_EQ("failed", result->get());
+}   // TEST exception
+
+TEST( Test_continuation, when_all )
+{
+    asynchronous::FutureValue<int> a;
+    asynchronous::FutureValue<std::string> b;
+    asynchronous::FutureValue<void> c;
+
+    auto all = asynchronous::when_all(a, b, c).then([](auto ready)
+               {
+                   auto results = ready.get();
+                   std::get<2>(results).get();
+                   return std::get<1>(results).get() + std::to_string(std::get<0>(results).get());
+               });
+
+    b.set_value("answer ");
+    c.set_value();
+    EXPECT_EQ(std::future_status::timeout, all->wait_for(ms(0)));
+
+    std::thread([&a] { a.set_value(42); }).join();
+    EXPECT_EQ("answer 42", all->get());
+
+    auto none = asynchronous::when_all();
+    EXPECT_EQ(std::future_status::ready, none->wait_for(ms(0)));
+}   // TEST when_all
+
+TEST( Test_continuation, when_all_range )
+{
+    std::vector< asynchronous::FutureValue<int> > values(10);
+
+    auto sum = asynchronous::when_all(values.begin(), values.end())
+                    .then([](std::future< std::vector< std::future<int> > > ready)
+                    {
+                        int result = 0;
+                        for(auto& value : ready.get()) { result += value.get(); }
+                        return result;
+                    });
+
+    for(int i = 0; i < 10; ++i) { values[static_cast<size_t>(i)].set_value(i); }
+    EXPECT_EQ(45, sum->get());
+}   // TEST when_all_range
+
+TEST( Test_continuation, when_any )
+{
+    asynchronous::FutureValue<int> a;
+    asynchronous::FutureValue<std::string> b;
+
+    auto any = asynchronous::when_any(a, b);
+
+    b.set_value("first");
+    a.set_value(2);
+
+    auto result = any->get();
+    EXPECT_EQ(1u, result.index);
+    EXPECT_EQ("first", std::get<1>(result.futures).get());
+    EXPECT_FALSE(std::get<0>(result.futures).valid());
+}   // TEST when_any
+
+//******************************************************************************
+// EOF
+//******************************************************************************
@@ -0,0 +1,371 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/queue.hpp"
+#include "asynchronous/latch.hpp"
+#include "asynchronous/scheduler.hpp"
+#include "asynchronous/waiter.hpp"
+#include "asynchronous/work_stealing_pool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#include <exception>
+#endif
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+namespace {
+//******************************************************************************
+/**
+ * stands in for a std::coroutine_handle, so the awaitables
+ * can be tested without a C++20 compiler
+ */
+struct FakeHandle
+{
+    std::atomic_int* resumed;
+    void resume() const { ++(*resumed); }
+};
+
+/**
+ * a handle, that runs the "rest of the coroutine" on resume
+ */
+struct FuncHandle
+{
+    std::function<void()> func;
+    void resume() const { func(); }
+};
+
+template<typename AWAITER>
+void suspend(AWAITER& awaiter, std::atomic_int& resumed)
+{
+    EXPECT_FALSE(awaiter.await_ready());
+    EXPECT_TRUE(awaiter.await_suspend(FakeHandle{&resumed}));
+}
+
+template<typename DURATION>
+bool waitFor(const std::atomic_int& counter, int expected, const DURATION& timeout)
+{
+    auto end = std::chrono::steady_clock::now() + timeout;
+    while (counter.load() != expected)
+    {
+        if (std::chrono::steady_clock::now() > end) { return false; }
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+//******************************************************************************
+}  // namespace
+
+//******************************************************************************
+TEST( Test_coroutine, when_popped_value_available )
+{
+    asynchronous::Queue<int> queue;
+    queue->push(42);
+
+    int value = 0;
+    queue->when_popped(asynchronous::InlineExecutor{},
+                       [&value](asynchronous::PopResult<decltype(queue)> result)
+                       { value = result.value; });
+
+    EXPECT_EQ(42, value);
+    EXPECT_TRUE(queue->empty());
+}   // TEST when_popped_value_available
+
+TEST( Test_coroutine, async_pop_resumes_on_push )
+{
+    asynchronous::Queue<int> queue;
+    std::atomic_int resumed{0};
+
+    auto awaiter = queue->async_pop();
+    suspend(awaiter, resumed);
+    EXPECT_EQ(0, resumed.load());
+
+    queue->push(7);
+    EXPECT_EQ(1, resumed.load());
+    EXPECT_TRUE(awaiter.await_ready());
+
+    auto result = awaiter.await_resume();
+    EXPECT_TRUE(result.isValid());
+    EXPECT_EQ(7, result.value);
+    EXPECT_TRUE(queue->empty());
+}   // TEST async_pop_resumes_on_push
+
+TEST( Test_coroutine, async_pop_value_available )
+{
+    asynchronous::Queue<int> queue;
+    queue->push(42);
+
+    auto awaiter = queue->async_pop();
+    EXPECT_TRUE(awaiter.await_ready());     // no suspend at all
+    EXPECT_EQ(42, awaiter.await_resume().value);
+}   // TEST async_pop_value_available
+
+TEST( Test_coroutine, async_pop_completes_in_suspend )
+{
+    asynchronous::Queue<int> queue;
+    std::atomic_int resumed{0};
+
+    auto awaiter = queue->async_pop();
+    EXPECT_FALSE(awaiter.await_ready());
+    queue->push(3);
+
+    // the callback runs inside await_suspend: do not suspend, and do not resume
+    EXPECT_FALSE(awaiter.await_suspend(FakeHandle{&resumed}));
+    EXPECT_EQ(0, resumed.load());
+    EXPECT_EQ(3, awaiter.await_resume().value);
+}   // TEST async_pop_completes_in_suspend
+
+TEST( Test_coroutine, async_pop_finished_queue )
+{
+    auto writer = std::make_unique< asynchronous::SharedQueue<int> >();
+    auto reader = writer->as_reader();
+    std::atomic_int resumed{0};
+
+    auto awaiter = reader->async_pop();
+    suspend(awaiter, resumed);
+
+    writer.reset();
+    EXPECT_EQ(1, resumed.load());
+    EXPECT_EQ(asynchronous::PopState<decltype(reader)>::empty, awaiter.await_resume().state);
+}   // TEST async_pop_finished_queue
+
+TEST( Test_coroutine, when_ready_waits_for_target )
+{
+    asynchronous::WorkStealingPool pool(2);
+    auto counter = asynchronous::createWaiterForAtLeast(0);
+    std::atomic_int fired{0};
+
+    counter.when_ready(pool, [&fired]() { ++fired; }, 3);
+    counter += 2;
+    EXPECT_FALSE(waitFor(fired, 1, std::chrono::milliseconds{20}));
+
+    counter += 1;
+    EXPECT_TRUE(waitFor(fired, 1, std::chrono::seconds{5}));
+}   // TEST when_ready_waits_for_target
+
+TEST( Test_coroutine, when_ready_own_targets )
+{
+    auto counter = asynchronous::createWaiterForAtLeast(0);
+    int fired10 = 0;
+    int fired7 = 0;
+
+    counter.when_ready(asynchronous::InlineExecutor{}, [&fired10]() { ++fired10; }, 10);
+    EXPECT_FALSE(counter.try_wait(5));      // sets up the shared predicate for 5
+    counter += 5;
+    EXPECT_EQ(0, fired10);
+
+    counter.when_ready(asynchronous::InlineExecutor{}, [&fired7]() { ++fired7; }, 7);
+    EXPECT_FALSE(counter.try_wait(20));     // and now for 20
+    counter += 2;
+    EXPECT_EQ(0, fired10);
+    EXPECT_EQ(1, fired7);
+
+    counter += 3;
+    EXPECT_EQ(1, fired10);
+    EXPECT_EQ(1, fired7);
+}   // TEST when_ready_own_targets
+
+TEST( Test_coroutine, async_wait_inline_modifies_waiter )
+{
+    auto counter = asynchronous::createWaiterForAtLeast(0);
+    int resumed = 0;
+
+    auto awaiter = counter.async_wait(asynchronous::InlineExecutor{}, 2);
+    EXPECT_FALSE(awaiter.await_ready());
+
+    // the resumed "coroutine" uses the waiter again, so it must not run under its lock
+    EXPECT_TRUE(awaiter.await_suspend(FuncHandle{ [&counter, &resumed]()
+                                                  {
+                                                      ++resumed;
+                                                      counter += 10;
+                                                      EXPECT_EQ(12, counter.getValue());
+                                                  } }));
+    counter += 2;
+    EXPECT_EQ(1, resumed);
+    EXPECT_EQ(12, counter.getValue());
+
+    auto ready = counter.async_wait(asynchronous::InlineExecutor{}, 5);
+    EXPECT_TRUE(ready.await_ready());
+}   // TEST async_wait_inline_modifies_waiter
+
+TEST( Test_coroutine, latch_async_wait_inline )
+{
+    asynchronous::latch latch(1);
+    int resumed = 0;
+
+    auto awaiter = latch.async_wait(asynchronous::InlineExecutor{});
+    EXPECT_FALSE(awaiter.await_ready());
+    EXPECT_TRUE(awaiter.await_suspend(FuncHandle{ [&latch, &resumed]()
+                                                  {
+                                                      ++resumed;
+                                                      EXPECT_TRUE(latch.try_wait());
+                                                  } }));
+    latch.count_down();
+    EXPECT_EQ(1, resumed);
+}   // TEST latch_async_wait_inline
+
+TEST( Test_coroutine, latch_async_wait )
+{
+    asynchronous::WorkStealingPool pool(2);
+    asynchronous::latch latch(2);
+    std::atomic_int resumed{0};
+
+    auto awaiter = latch.async_wait(pool);
+    suspend(awaiter, resumed);
+
+    latch.count_down();
+    latch.count_down();
+    EXPECT_TRUE(waitFor(resumed, 1, std::chrono::seconds{5}));
+}   // TEST latch_async_wait
+
+TEST( Test_coroutine, scheduler_sleep_for )
+{
+    asynchronous::Scheduler scheduler;
+    std::atomic_int resumed{0};
+    const auto start = std::chrono::steady_clock::now();
+
+    auto awaiter = scheduler.sleep_for(std::chrono::milliseconds{10});
+    suspend(awaiter, resumed);
+
+    EXPECT_TRUE(waitFor(resumed, 1, std::chrono::seconds{5}));
+    EXPECT_LE(std::chrono::milliseconds{10}, std::chrono::steady_clock::now() - start);
+}   // TEST scheduler_sleep_for
+
+//******************************************************************************
+#if defined(__cpp_impl_coroutine)
+//******************************************************************************
+namespace {
+//******************************************************************************
+/**
+ * a minimal fire-and-forget coroutine type
+ */
+struct Detached
+{
+    struct promise_type
+    {
+        Detached get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+Detached consume(asynchronous::Queue<int>& queue,
+                 asynchronous::WorkStealingPool& pool,
+                 std::atomic_int& sum,
+                 asynchronous::latch& done)
+{
+    while (true)
+    {
+        auto result = co_await queue->async_pop(pool);
+        if (not result) { break; }
+        sum += result.value;
+    }
+    done.count_down();
+}
+
+Detached consumeInline(asynchronous::Queue<int>& queue, int& sum)
+{
+    while (true)
+    {
+        auto result = co_await queue->async_pop();
+        if (not result) { break; }
+        sum += result.value;
+    }
+}
+
+Detached sleepThenCount(asynchronous::Scheduler& scheduler,
+                        asynchronous::WorkStealingPool& pool,
+                        asynchronous::latch& start,
+                        asynchronous::latch& done)
+{
+    co_await start.async_wait(pool);
+    co_await scheduler.sleep_for(std::chrono::milliseconds{1}, pool);
+    done.count_down();
+}
+
+//******************************************************************************
+}  // namespace
+
+//******************************************************************************
+TEST( Test_coroutine, co_await_queue )
+{
+    constexpr size_t consumers = 1000;
+    asynchronous::WorkStealingPool pool(4);
+    auto writer = std::make_unique< asynchronous::SharedQueue<int> >();
+    auto reader = writer->as_reader();
+    asynchronous::latch done(consumers);
+    std::atomic_int sum{0};
+
+    for (size_t i = 0; i < consumers; ++i) { consume(reader, pool, sum, done); }
+    for (int i = 1; i <= 100; ++i) { (*writer)->push(i); }
+    writer.reset();
+
+    EXPECT_TRUE(done.wait_for(std::chrono::seconds{5}));
+    EXPECT_EQ(5050, sum.load());
+}   // TEST co_await_queue
+
+TEST( Test_coroutine, co_await_filled_queue_inline )
+{
+    // every item is there already: the loop must not grow the stack
+    constexpr int count = 1000000;
+    auto writer = std::make_unique< asynchronous::SharedQueue<int> >();
+    auto reader = writer->as_reader();
+    for (int i = 0; i < count; ++i) { (*writer)->push(1); }
+
+    int sum = 0;
+    consumeInline(reader, sum);
+    EXPECT_EQ(count, sum);
+
+    writer.reset();
+}   // TEST co_await_filled_queue_inline
+
+TEST( Test_coroutine, co_await_latch_and_scheduler )
+{
+    constexpr size_t sleepers = 100;
+    asynchronous::WorkStealingPool pool(2);
+    asynchronous::Scheduler scheduler;
+    asynchronous::latch start(1);
+    asynchronous::latch done(sleepers);
+
+    for (size_t i = 0; i < sleepers; ++i) { sleepThenCount(scheduler, pool, start, done); }
+    EXPECT_FALSE(done.try_wait());
+
+    start.count_down();
+    EXPECT_TRUE(done.wait_for(std::chrono::seconds{5}));
+}   // TEST co_await_latch_and_scheduler
+
+//******************************************************************************
+#endif
+//******************************************************************************
+// EOF
+//******************************************************************************
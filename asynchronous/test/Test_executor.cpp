@@ -0,0 +1,242 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/start_threads.hpp"
+#include "asynchronous/lazy_thread_pool.hpp"
+#include "asynchronous/work_stealing_pool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <set>
+#include <thread>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+static_assert( asynchronous::is_executor_v<asynchronous::InlineExecutor> );
+static_assert( asynchronous::is_executor_v<asynchronous::ThreadExecutor> );
+static_assert( asynchronous::is_executor_v<asynchronous::LazyThreadPool&> );
+static_assert( asynchronous::is_executor_v<asynchronous::WorkStealingPool&> );
+static_assert( not asynchronous::is_executor_v<int> );
+
+//******************************************************************************
+TEST( Test_executor, inline )
+{
+    asynchronous::InlineExecutor executor;
+
+    auto future = asynchronous::invoke_async(executor, [](int a) { return a; }, 42);
+    EXPECT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds{0}));
+    EXPECT_EQ(42, future.get());
+
+    auto thread = asynchronous::invoke_async(asynchronous::InlineExecutor{}, [] { return std::this_thread::get_id(); });
+    EXPECT_EQ(std::this_thread::get_id(), thread.get());
+}   // TEST inline
+
+TEST( Test_executor, thread )
+{
+    auto future = asynchronous::invoke_async(asynchronous::ThreadExecutor{}, [] { return std::this_thread::get_id(); });
+    EXPECT_NE(std::this_thread::get_id(), future.get());
+}   // TEST thread
+
+TEST( Test_executor, exception )
+{
+    asynchronous::WorkStealingPool pool(2);
+
+    auto future = asynchronous::invoke_async(pool, [] { throw std::runtime_error("failed"); });
+    EXPECT_THROW(future.get(), std::runtime_error);
+}   // TEST exception
+
+TEST( Test_executor, memberFunction )
+{
+    struct Adder
+    {
+        int ivValue;
+        int add(int a) const { return ivValue + a; }
+    };
+
+    const Adder adder{40};
+    asynchronous::LazyThreadPool pool(2);
+
+    auto future = asynchronous::invoke_async(pool, &Adder::add, &adder, 2);
+    EXPECT_EQ(42, future.get());
+}   // TEST memberFunction
+
+TEST( Test_executor, invoke_threads )
+{
+    asynchronous::WorkStealingPool pool(4);
+
+    std::atomic_int count{0};
+    auto futures = asynchronous::invoke_threads(pool, 8, [&count] (int a) { count += a; return a; }, 2);
+
+    int sum = 0;
+    for(auto& future : futures)
+    { sum += future.get(); }
+
+    EXPECT_EQ(16, sum);
+    EXPECT_EQ(16, count);
+}   // TEST invoke_threads
+
+TEST( Test_executor, run_threads_reuses_threads )
+{
+    asynchronous::WorkStealingPool pool(3);
+
+    std::mutex mutex;
+    std::set<std::thread::id> ids;
+
+    for(int round = 0; round < 20; ++round)
+    {
+        asynchronous::run_threads(pool, 4, [&] ()
+        {
+            std::lock_guard<std::mutex> lck(mutex);
+            ids.insert(std::this_thread::get_id());
+        });
+    }
+
+    // three pool threads plus the calling thread
+    EXPECT_GE(4u, ids.size());
+}   // TEST run_threads_reuses_threads
+
+TEST( Test_executor, for_each )
+{
+    asynchronous::LazyThreadPool lazyPool(3);
+    asynchronous::WorkStealingPool stealingPool(3);
+
+    std::vector<int> numbers(1000);
+
+    asynchronous::for_each(lazyPool, 4, numbers, [](int& a) { a += 1; });
+    asynchronous::for_each(stealingPool, 4, asynchronous::static_chunk(10), numbers, [](int& a) { a += 2; });
+    asynchronous::for_each(asynchronous::InlineExecutor{}, 4, numbers, [](int b, int& a) { a += b; }, 3);
+    asynchronous::for_each(asynchronous::ThreadExecutor{}, 4, numbers, [](int& a) { a += 4; });
+
+    EXPECT_EQ( std::vector<int>(1000, 10), numbers );
+}   // TEST for_each
+
+TEST( Test_executor, nested_for_each )
+{
+    // every element starts another for_each on the same pool,
+    // the waiting threads have to help, otherwise this dead-locks
+    asynchronous::WorkStealingPool pool(2);
+
+    std::vector< std::vector<int> > matrix(16, std::vector<int>(64, 1));
+    std::vector<int> sums(matrix.size());
+
+    asynchronous::for_each_index(1, matrix.size(), [&] (size_t row)
+    {
+        asynchronous::for_each(pool, 4, matrix[row], [](int& a) { a *= 2; });
+        sums[row] = std::accumulate(matrix[row].begin(), matrix[row].end(), 0);
+    });
+
+    asynchronous::for_each(pool, 4, matrix, [&pool] (std::vector<int>& row)
+    {
+        asynchronous::for_each(pool, 4, row, [](int& a) { a += 1; });
+    });
+
+    for(auto& row : matrix)
+    { EXPECT_EQ(std::vector<int>(64, 3), row); }
+    EXPECT_EQ(std::vector<int>(16, 128), sums);
+}   // TEST nested_for_each
+
+TEST( Test_executor, invoke_on_each )
+{
+    asynchronous::WorkStealingPool pool(2);
+
+    std::vector<int> numbers = { 1,2,3,4,5 };
+    auto results = asynchronous::invoke_on_each(pool, 2, numbers, [](int& a, int b)
+                   {
+                        auto t = a;
+                        a += b;
+                        return t;
+                   }, 1);
+
+    EXPECT_EQ(numbers.size(), results.size());
+    EXPECT_EQ(2u, results.threadCount());
+
+    int sum = 0;
+    for(auto& result : results)
+    { sum += result->get(); }
+
+    EXPECT_EQ( 15, sum);
+    EXPECT_EQ( (std::vector<int>{2,3,4,5,6}), numbers );
+}   // TEST invoke_on_each
+
+TEST( Test_executor, invoke_on_each_rvalue_executor )
+{
+    auto results = asynchronous::invoke_on_each(asynchronous::ThreadExecutor{}, 3,
+                                                std::vector<int>{1,2,3,4},
+                                                [](int a) { return a * a; });
+
+    int sum = 0;
+    for(auto& result : results)
+    { sum += result->get(); }
+
+    EXPECT_EQ( 30, sum);
+}   // TEST invoke_on_each_rvalue_executor
+
+TEST( Test_executor, pool_drains_on_destruction )
+{
+    std::atomic_int count{0};
+    {
+        asynchronous::WorkStealingPool pool(2);
+        for(int i = 0; i < 100; ++i)
+        {
+            pool.execute([&count, &pool]
+            {
+                pool.execute([&count] { ++count; }); // added while running
+                ++count;
+            });
+        }
+    }
+    EXPECT_EQ(200, count);
+}   // TEST pool_drains_on_destruction
+
+/**
+ * NOTE: disabled, because it takes a while and just prints the timing
+ *       run with --gtest_also_run_disabled_tests
+ */
+TEST( Test_executor, DISABLED_benchmark )
+{
+    using clock = std::chrono::steady_clock;
+    using us = std::chrono::duration<double, std::micro>;
+
+    constexpr size_t requests = 2000;
+    const size_t threadCount = std::max(2u, std::thread::hardware_concurrency());
+    std::vector<int> numbers(256, 1);
+    auto increment = [](int& a) { ++a; };
+
+    auto start = clock::now();
+    for(size_t i = 0; i < requests; ++i)
+    { asynchronous::for_each(threadCount, numbers, increment); }
+    std::cout << "for_each with new threads : " << us(clock::now() - start).count() / requests << " us per call" << std::endl;
+
+    asynchronous::WorkStealingPool pool(threadCount - 1);
+    start = clock::now();
+    for(size_t i = 0; i < requests; ++i)
+    { asynchronous::for_each(pool, threadCount, numbers, increment); }
+    std::cout << "for_each on the pool      : " << us(clock::now() - start).count() / requests << " us per call" << std::endl;
+}   // TEST benchmark
+
+//******************************************************************************
+// EOF
+//******************************************************************************
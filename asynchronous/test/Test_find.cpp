@@ -0,0 +1,99 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/find.hpp"
+
+#include <atomic>
+#include <list>
+#include <numeric>
+#include <stdexcept>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+TEST( Test_find, lowest_index )
+{
+    std::vector<int> numbers(100000);
+    std::iota(numbers.begin(), numbers.end(), 0);
+
+    // many matches, the first one has to win for every thread count
+    auto isMatch = [](int a) { return (a >= 1234) && (a % 7 == 0); };
+
+    for(size_t threadCount = 1; threadCount <= 8; ++threadCount)
+    {
+        auto pos = asynchronous::find_if(threadCount, numbers, isMatch);
+        ASSERT_NE(numbers.end(), pos);
+        EXPECT_EQ(1239, *pos) << "threadCount: " << threadCount;
+    }
+}   // TEST lowest_index
+
+TEST( Test_find, no_match )
+{
+    const std::list<int> numbers = { 1,3,5,7,9 };
+
+    auto pos = asynchronous::find_if(3, numbers, [](int a) { return a % 2 == 0; });
+    EXPECT_EQ(numbers.end(), pos);
+
+    auto odd = asynchronous::find_if(3, numbers, [](int a) { return a > 4; });
+    EXPECT_EQ(5, *odd);
+}   // TEST no_match
+
+TEST( Test_find, early_exit )
+{
+    std::vector<int> numbers(1000000, 0);
+    numbers[10] = 1;
+
+    std::atomic_size_t calls{0};
+    auto pos = asynchronous::find_if(4, numbers, [&calls](int a) { ++calls; return a == 1; });
+
+    EXPECT_EQ(10, std::distance(numbers.begin(), pos));
+    EXPECT_GT(numbers.size() / 2, calls);
+}   // TEST early_exit
+
+TEST( Test_find, any_of_all_of )
+{
+    std::vector<int> numbers(10000, 2);
+
+    EXPECT_TRUE(asynchronous::all_of(4, numbers, [](int a) { return a % 2 == 0; }));
+    EXPECT_FALSE(asynchronous::any_of(4, numbers, [](int a) { return a % 2 != 0; }));
+
+    numbers[9876] = 3;
+    EXPECT_FALSE(asynchronous::all_of(4, numbers, [](int a) { return a % 2 == 0; }));
+    EXPECT_TRUE(asynchronous::any_of(4, numbers, [](int a) { return a % 2 != 0; }));
+
+    EXPECT_TRUE(asynchronous::all_of(4, std::vector<int>{}, [](int) { return false; }));
+    EXPECT_FALSE(asynchronous::any_of(4, std::vector<int>{}, [](int) { return true; }));
+}   // TEST any_of_all_of
+
+TEST( Test_find, exception )
+{
+    std::vector<int> numbers(1000, 1);
+
+    EXPECT_THROW(asynchronous::any_of(4, numbers, [](int a) -> bool { throw std::runtime_error("failed" + std::to_string(a)); }),
+                 std::runtime_error);
+    EXPECT_THROW(asynchronous::find_if(0, numbers, [](int) { return true; }), std::invalid_argument);
+}   // TEST exception
+
+//******************************************************************************
+// EOF
+//******************************************************************************
@@ -0,0 +1,412 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/lightweight/barrier.hpp"
+#include "asynchronous/lightweight/latch.hpp"
+#include "asynchronous/lightweight/onetimesignal.hpp"
+#include "asynchronous/lightweight/sharded_counter.hpp"
+#include "asynchronous/lightweight/tree_barrier.hpp"
+#include "asynchronous/barrier.hpp"
+#include "asynchronous/waiter.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+TEST( Test_lightweight, latch_count_down )
+{
+    asynchronous::lightweight::latch l(1);
+
+    EXPECT_FALSE(l.try_wait());
+    EXPECT_FALSE(l.wait_for(std::chrono::microseconds{1}));
+
+    EXPECT_TRUE(l.count_down());
+
+    EXPECT_TRUE(l.wait_for(std::chrono::microseconds{1}));
+    EXPECT_TRUE(l.try_wait());
+    EXPECT_THROW(l.count_down(), std::logic_error);
+}   // TEST latch_count_down
+
+TEST( Test_lightweight, latch_wait )
+{
+    constexpr size_t count = 8;
+    asynchronous::lightweight::latch l(count);
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < count; ++i)
+    { threads.emplace_back([&l]() { l.count_down(); }); }
+
+    l.wait();
+    EXPECT_TRUE(l.try_wait());
+    EXPECT_EQ(0u, l.getValue());
+
+    for (auto& t : threads) { t.join(); }
+}   // TEST latch_wait
+
+TEST( Test_lightweight, barrier_phases )
+{
+    constexpr size_t count = 4;
+    constexpr size_t phases = 1000;
+    std::atomic_size_t resets{0};
+
+    asynchronous::lightweight::barrier b(count, [&resets](const size_t& c)
+                                                { ++resets; return c; });
+    std::atomic_size_t arrived{0};
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < count; ++i)
+    {
+        threads.emplace_back([&]()
+            {
+                for (size_t p = 0; p < phases; ++p)
+                {
+                    ++arrived;
+                    b.count_down_and_wait();
+                    EXPECT_LE((p+1) * count, arrived.load());
+                    b.count_down_and_wait();
+                }
+            });
+    }
+    for (auto& t : threads) { t.join(); }
+
+    EXPECT_EQ(2 * phases, resets.load());
+    EXPECT_EQ(count, b.getResetCount());
+}   // TEST barrier_phases
+
+TEST( Test_lightweight, barrier_reset )
+{
+    asynchronous::lightweight::barrier b(1, [](const size_t& c) { return c + 1; });
+    EXPECT_THROW(asynchronous::lightweight::barrier(0), std::invalid_argument);
+
+    b.count_down_and_wait();
+    EXPECT_EQ(2u, b.getResetCount());
+
+    EXPECT_FALSE(b.count_down_and_wait_for(std::chrono::microseconds{1}));
+
+    std::thread t([&b]() { b.count_down_and_wait(); });
+    t.join();
+    EXPECT_EQ(3u, b.getResetCount());
+}   // TEST barrier_reset
+
+TEST( Test_lightweight, barrier_growing )
+{
+    // every reset adds a thread, which arrives right away (maybe while the reset is not done)
+    constexpr size_t maxCount = 8;
+    constexpr size_t phases = 200;
+    std::atomic_size_t arrived{0};
+    std::vector<std::thread> threads;
+    std::function<void(size_t)> participate;
+
+    asynchronous::lightweight::barrier b(1, [&](const size_t& c)
+            {
+                if (c < maxCount) { threads.emplace_back(participate, c); }
+                return std::min(c + 1, maxCount);
+            });
+
+    // phase p has min(p+1, maxCount) threads
+    auto arrivalsUntil = [&](size_t phase)
+            {
+                size_t sum = 0;
+                for (size_t p = 0; p <= phase; ++p) { sum += std::min(p + 1, maxCount); }
+                return sum;
+            };
+
+    participate = [&](size_t first)
+            {
+                for (size_t p = first; p < phases; ++p)
+                {
+                    ++arrived;
+                    b.count_down_and_wait();
+                    EXPECT_LE(arrivalsUntil(p), arrived.load());
+                }
+            };
+
+    participate(0);
+    for (auto& t : threads) { t.join(); }
+
+    EXPECT_EQ(maxCount - 1, threads.size());
+    EXPECT_EQ(arrivalsUntil(phases - 1), arrived.load());
+}   // TEST barrier_growing
+
+TEST( Test_lightweight, barrier_reset_throws )
+{
+    bool fail = true;
+    asynchronous::lightweight::barrier b(2, [&fail](const size_t& c)
+            {
+                if (fail) { fail = false; throw std::runtime_error("reset failed"); }
+                return c;
+            });
+
+    // the last one gets the exception, the other one is released,
+    // and the next phase starts with the last count
+    std::atomic_int failures{0};
+    auto arrive = [&b, &failures]()
+            {
+                try { b.count_down_and_wait(); }
+                catch(const std::runtime_error&) { ++failures; }
+            };
+    std::thread t(arrive);
+    arrive();
+    t.join();
+    EXPECT_EQ(1, failures.load());
+    EXPECT_EQ(2u, b.getResetCount());
+
+    std::thread t2([&b]() { b.count_down_and_wait(); });
+    b.count_down_and_wait();
+    t2.join();
+}   // TEST barrier_reset_throws
+
+TEST( Test_lightweight, barrier_timeout_while_resetting )
+{
+    std::atomic_bool resetting{false};
+    std::atomic_bool done{false};
+    asynchronous::lightweight::barrier b(1, [&](const size_t& c)
+            {
+                resetting = true;
+                while (not done) { std::this_thread::yield(); }
+                return c;
+            });
+
+    std::thread t([&b]() { b.count_down_and_wait(); });
+    while (not resetting) { std::this_thread::yield(); }
+
+    // the arrival waits for the reset, but not longer than the timeout
+    EXPECT_FALSE(b.count_down_and_wait_for(std::chrono::milliseconds{1}));
+    done = true;
+    t.join();
+
+    EXPECT_TRUE(b.count_down_and_wait_for(std::chrono::seconds{5}));
+}   // TEST barrier_timeout_while_resetting
+
+TEST( Test_lightweight, OneTimeSignal )
+{
+    asynchronous::lightweight::OneTimeSignal s;
+
+    EXPECT_TRUE(s.wait_for(std::chrono::milliseconds(1)));
+
+    std::thread t([&s]() { s.notify(); });
+    EXPECT_FALSE(s.wait_for(std::chrono::seconds(5)));
+    t.join();
+
+    s.notify();
+    EXPECT_FALSE(s.wait_for(std::chrono::milliseconds(0)));
+}   // TEST OneTimeSignal
+
+TEST( Test_lightweight, tree_barrier_phases )
+{
+    constexpr size_t count = 11;    // not a multiple of the fanIn
+    constexpr size_t phases = 1000;
+    std::atomic_size_t resets{0};
+
+    asynchronous::lightweight::tree_barrier b(count, [&resets](const size_t& c)
+                                                     { ++resets; return c; }, 3);
+    std::atomic_size_t arrived{0};
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < count; ++i)
+    {
+        threads.emplace_back([&, i]()
+            {
+                for (size_t p = 0; p < phases; ++p)
+                {
+                    ++arrived;
+                    b.count_down_and_wait(i);
+                    EXPECT_LE((p+1) * count, arrived.load());
+                    b.count_down_and_wait();
+                }
+            });
+    }
+    for (auto& t : threads) { t.join(); }
+
+    EXPECT_EQ(2 * phases, resets.load());
+    EXPECT_THROW(b.count_down_and_wait(count), std::logic_error);
+}   // TEST tree_barrier_phases
+
+TEST( Test_lightweight, tree_barrier_reset )
+{
+    asynchronous::lightweight::tree_barrier b(1, [](const size_t& c) { return c + 1; });
+    EXPECT_THROW(asynchronous::lightweight::tree_barrier(0), std::invalid_argument);
+    auto same = [](const size_t& c) { return c; };
+    EXPECT_THROW(asynchronous::lightweight::tree_barrier(2, same, 0), std::invalid_argument);
+    EXPECT_THROW(asynchronous::lightweight::tree_barrier(2, same, 1), std::invalid_argument);
+    EXPECT_NO_THROW(asynchronous::lightweight::tree_barrier(2, same, 2));
+
+    b.count_down_and_wait();
+    EXPECT_EQ(2u, b.getResetCount());
+
+    std::thread t([&b]() { b.count_down_and_wait(); });
+    b.count_down_and_wait();
+    t.join();
+    EXPECT_EQ(3u, b.getResetCount());
+}   // TEST tree_barrier_reset
+
+//------------------------------------------------------------------------------
+template<typename BARRIER>
+static std::chrono::nanoseconds measurePhases(size_t threadCount, size_t phases)
+{
+    BARRIER b(threadCount);
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&b, phases]()
+            { for (size_t p = 0; p < phases; ++p) { b.count_down_and_wait(); } });
+    }
+    for (auto& t : threads) { t.join(); }
+    return (std::chrono::steady_clock::now() - start) / phases;
+}
+
+// NOTE: this is a benchmark, run it with --gtest_also_run_disabled_tests
+TEST( Test_lightweight, DISABLED_benchmark_barrier )
+{
+    constexpr size_t phases = 10000;
+    const size_t maxThreads = std::max(2u, std::thread::hardware_concurrency());
+
+    for (size_t threads = 2; threads <= maxThreads; threads *= 2)
+    {
+        auto classic = measurePhases<asynchronous::barrier>(threads, phases);
+        auto light = measurePhases<asynchronous::lightweight::barrier>(threads, phases);
+        auto tree = measurePhases<asynchronous::lightweight::tree_barrier>(threads, phases);
+        std::cout << threads << " threads, per phase: barrier "
+                  << classic.count() << "ns, lightweight::barrier "
+                  << light.count() << "ns, lightweight::tree_barrier "
+                  << tree.count() << "ns" << std::endl;
+    }
+}   // TEST DISABLED_benchmark_barrier
+
+//------------------------------------------------------------------------------
+TEST( Test_lightweight, sharded_counter )
+{
+    asynchronous::lightweight::ShardedCounter c(5, 3);
+    EXPECT_EQ(4u, c.getShardCount());
+    EXPECT_EQ(5u, c.getValue());
+
+    constexpr size_t threadCount = 8;
+    constexpr size_t loops = 10000;
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&c]()
+            { for (size_t n = 0; n < loops; ++n) { ++c; } });
+    }
+    for (auto& t : threads) { t.join(); }
+
+    EXPECT_EQ(5 + threadCount * loops, c.getValue());
+}   // TEST sharded_counter
+
+//------------------------------------------------------------------------------
+TEST( Test_lightweight, sharded_counter_wait )
+{
+    asynchronous::lightweight::ShardedCounter c;
+
+    EXPECT_TRUE(c.wait_for(std::chrono::microseconds{1}, 0));
+    EXPECT_FALSE(c.wait_for(std::chrono::microseconds{1}, 1));
+
+    constexpr size_t threadCount = 4;
+    constexpr size_t loops = 1000;
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&c]()
+            { for (size_t n = 0; n < loops; ++n) { c += 2; } });
+    }
+
+    c.wait(threadCount * loops);
+    EXPECT_GE(c.getValue(), threadCount * loops);
+    EXPECT_TRUE(c.wait_for(std::chrono::seconds{10}, 2 * threadCount * loops));
+    EXPECT_EQ(2 * threadCount * loops, c.getValue());
+
+    for (auto& t : threads) { t.join(); }
+}   // TEST sharded_counter_wait
+
+//------------------------------------------------------------------------------
+TEST( Test_lightweight, sharded_counter_wake_ups )
+{
+    asynchronous::lightweight::ShardedCounter c(0, 4);
+
+    constexpr size_t threadCount = 4;
+    constexpr size_t loops = 100000;
+    constexpr size_t target = threadCount * loops;
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&c]()
+            { for (size_t n = 0; n < loops; ++n) { ++c; } });
+    }
+
+    c.wait(target);
+    EXPECT_EQ(target, c.getValue());
+    for (auto& t : threads) { t.join(); }
+
+    // a waiter must not turn every increment into a wake-up
+    EXPECT_GT(target / 100, c.getWakeUpCount());
+}   // TEST sharded_counter_wake_ups
+
+//------------------------------------------------------------------------------
+template<typename COUNTER>
+static std::chrono::nanoseconds measureIncrements(size_t threadCount, size_t loops)
+{
+    COUNTER c(0);
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&c, loops]()
+            { for (size_t n = 0; n < loops; ++n) { c += 1; } });
+    }
+    for (auto& t : threads) { t.join(); }
+    return (std::chrono::steady_clock::now() - start) / (loops * threadCount);
+}
+
+// NOTE: this is a benchmark, run it with --gtest_also_run_disabled_tests
+TEST( Test_lightweight, DISABLED_benchmark_counter )
+{
+    constexpr size_t loops = 1000000;
+    const size_t maxThreads = std::max(2u, std::thread::hardware_concurrency());
+
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        auto waiter = measureIncrements< asynchronous::WaiterForAtLeast<size_t> >(threads, loops);
+        auto sharded = measureIncrements<asynchronous::lightweight::ShardedCounter>(threads, loops);
+        std::cout << threads << " threads, per increment: WaiterForAtLeast "
+                  << waiter.count() << "ns, lightweight::ShardedCounter "
+                  << sharded.count() << "ns" << std::endl;
+    }
+}   // TEST DISABLED_benchmark_counter
+
+//******************************************************************************
+// EOF
+//******************************************************************************
@@ -0,0 +1,187 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/parallel.hpp"
+#include "asynchronous/work_stealing_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+namespace {
+//******************************************************************************
+/**
+ * divide and conquer: every level calls parallel_invoke again
+ */
+template<typename EXECUTOR, typename ITERATOR>
+void quicksort(EXECUTOR& executor, ITERATOR begin, ITERATOR end)
+{
+    if (end - begin < 1000)
+    {
+        std::sort(begin, end);
+        return;
+    }
+
+    auto pivot = *(begin + (end - begin) / 2);
+    auto middle1 = std::partition(begin, end, [pivot](const auto& v) { return v < pivot; });
+    auto middle2 = std::partition(middle1, end, [pivot](const auto& v) { return not (pivot < v); });
+
+    asynchronous::parallel_invoke(executor,
+            [&]() { quicksort(executor, begin, middle1); },
+            [&]() { quicksort(executor, middle2, end); } );
+}
+
+std::vector<int> randomValues(size_t count)
+{
+    std::vector<int> values(count);
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> distribution(0, 1000000);
+    for(auto& v : values) { v = distribution(random); }
+    return values;
+}
+
+//******************************************************************************
+}  // namespace
+
+//******************************************************************************
+TEST( Test_parallel, invoke )
+{
+    asynchronous::WorkStealingPool pool(2);
+
+    std::atomic_int a{0};
+    std::atomic_int b{0};
+    std::atomic_int c{0};
+    asynchronous::parallel_invoke(pool, [&]() { a = 1; }, [&]() { b = 2; }, [&]() { c = 3; });
+    EXPECT_EQ(1, a);
+    EXPECT_EQ(2, b);
+    EXPECT_EQ(3, c);
+
+    asynchronous::parallel_invoke(pool);                    // nothing to do
+    asynchronous::parallel_invoke(pool, [&]() { a = 4; });  // runs inline
+    EXPECT_EQ(4, a);
+
+    asynchronous::parallel_invoke([&]() { b = 5; }, [&]() { c = 6; });  // on the default pool
+    EXPECT_EQ(5, b);
+    EXPECT_EQ(6, c);
+}   // TEST invoke
+
+//------------------------------------------------------------------------------
+TEST( Test_parallel, exceptions )
+{
+    asynchronous::WorkStealingPool pool(2);
+
+    std::atomic_int done{0};
+    EXPECT_THROW(asynchronous::parallel_invoke(pool,
+                        [&]() { ++done; throw std::runtime_error("first"); },
+                        [&]() { ++done; throw std::logic_error("last"); }),
+                 std::runtime_error);
+    EXPECT_EQ(2, done);     // both ran
+
+    EXPECT_THROW(asynchronous::parallel_for(pool, 0, 100, 10,
+                        [](int i) { if (i == 42) { throw std::out_of_range("42"); } }),
+                 std::out_of_range);
+}   // TEST exceptions
+
+//------------------------------------------------------------------------------
+TEST( Test_parallel, nested )
+{
+    // a deep recursion on two workers must not dead-lock
+    asynchronous::WorkStealingPool pool(2);
+
+    auto values = randomValues(200000);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    quicksort(pool, values.begin(), values.end());
+    EXPECT_EQ(expected, values);
+}   // TEST nested
+
+//------------------------------------------------------------------------------
+TEST( Test_parallel, for_indexes )
+{
+    asynchronous::WorkStealingPool pool(3);
+
+    constexpr size_t count = 10000;
+    std::vector<std::atomic_int> hits(count);
+    asynchronous::parallel_for(pool, size_t{0}, count, 100, [&hits](size_t i) { ++hits[i]; });
+    for(const auto& h : hits) { ASSERT_EQ(1, h); }
+
+    std::atomic_int calls{0};
+    asynchronous::parallel_for(pool, 5, 5, 1, [&calls](int) { ++calls; });
+    asynchronous::parallel_for(pool, 5, 3, 1, [&calls](int) { ++calls; });
+    EXPECT_EQ(0, calls);
+
+    asynchronous::parallel_for(size_t{0}, count, 0, [&hits](size_t i) { ++hits[i]; });  // grain 0 means 1
+    for(const auto& h : hits) { ASSERT_EQ(2, h); }
+}   // TEST for_indexes
+
+//------------------------------------------------------------------------------
+TEST( Test_parallel, for_elements )
+{
+    asynchronous::WorkStealingPool pool(3);
+
+    std::vector<int> values(10000);
+    std::iota(values.begin(), values.end(), 0);
+
+    asynchronous::parallel_for(pool, values, 64, [](int& v) { v *= 2; });
+    for(size_t i = 0; i < values.size(); ++i) { ASSERT_EQ(static_cast<int>(2 * i), values[i]); }
+
+    asynchronous::parallel_for(values.begin() + 1, values.end(), 64, [](int& v) { v = 0; });
+    EXPECT_EQ(0, values[0]);
+    EXPECT_EQ(0, std::accumulate(values.begin(), values.end(), 0));
+}   // TEST for_elements
+
+//------------------------------------------------------------------------------
+// NOTE: this is a benchmark, run it with --gtest_also_run_disabled_tests
+TEST( Test_parallel, DISABLED_benchmark )
+{
+    const auto values = randomValues(10000000);
+    asynchronous::WorkStealingPool pool;
+
+    auto measure = [&values](auto&& sort)
+    {
+        auto copy = values;
+        auto start = std::chrono::steady_clock::now();
+        sort(copy);
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    };
+
+    auto sequential = measure([](auto& v) { std::sort(v.begin(), v.end()); });
+    auto parallel = measure([&pool](auto& v) { quicksort(pool, v.begin(), v.end()); });
+
+    std::cout << values.size() << " values on " << pool.size() << " workers: std::sort "
+              << sequential.count() << "ms, quicksort with parallel_invoke " << parallel.count() << "ms" << std::endl;
+}   // TEST DISABLED_benchmark
+
+//******************************************************************************
+// EOF
+//******************************************************************************
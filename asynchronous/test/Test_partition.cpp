@@ -0,0 +1,137 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/partition.hpp"
+#include "asynchronous/start_threads.hpp"
+
+#include <algorithm>
+#include <list>
+#include <numeric>
+#include <vector>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+using Kind = asynchronous::Partition::Kind;
+
+TEST( Test_partition, resolve )
+{
+    auto p = asynchronous::Partition{}.resolve(10, 4);
+    EXPECT_EQ( Kind::dynamic, p.getKind() );
+    EXPECT_EQ( 1u, p.getChunkSize() );
+
+    p = asynchronous::Partition{}.resolve(1000, 4);
+    EXPECT_EQ( Kind::guided, p.getKind() );
+
+    p = asynchronous::static_chunk().resolve(1000, 3);
+    EXPECT_EQ( Kind::static_chunk, p.getKind() );
+    EXPECT_EQ( 334u, p.getChunkSize() );
+
+    p = asynchronous::dynamic(0).resolve(1000, 3);
+    EXPECT_EQ( Kind::dynamic, p.getKind() );
+    EXPECT_EQ( 1u, p.getChunkSize() );
+}   // TEST resolve
+
+//------------------------------------------------------------------------------
+template<typename CONTAINER>
+static void checkEachElementOnce(CONTAINER& container, const asynchronous::Partition& partition)
+{
+    for(auto& e : container) { e = 0; }
+
+    asynchronous::for_each(3, partition, container, [](int& e) { ++e; });
+
+    for(auto& e : container) { EXPECT_EQ(1, e); }
+}
+
+TEST( Test_partition, for_each )
+{
+    std::vector<int> numbers(1001);
+    std::list<int> list(1001);
+
+    for(auto& partition : { asynchronous::Partition{},
+                            asynchronous::static_chunk(),
+                            asynchronous::static_chunk(7),
+                            asynchronous::dynamic(),
+                            asynchronous::dynamic(13),
+                            asynchronous::guided(),
+                            asynchronous::guided(5) })
+    {
+        checkEachElementOnce(numbers, partition);
+        checkEachElementOnce(list, partition);   // no random access
+    }
+}   // TEST for_each
+
+TEST( Test_partition, static_offsets )
+{
+    std::vector<int> numbers(10);
+    using Walker = asynchronous::details::PartitionWalker<std::vector<int>::iterator>;
+
+    // with only one thread working, it takes care of all slots
+    Walker walker(numbers.begin(), numbers.size(), 3, asynchronous::static_chunk(2));
+
+    std::vector<size_t> offsets;
+    walker.walk([&offsets](const Walker::Range& range)
+    {
+        offsets.push_back(range.offset);
+        EXPECT_GE( 2, range.last - range.first );
+    });
+
+    EXPECT_EQ( (std::vector<size_t>{ 0, 6, 2, 8, 4 }), offsets );
+}   // TEST static_offsets
+
+TEST( Test_partition, guided_shrinks )
+{
+    std::vector<int> numbers(1000);
+    using Walker = asynchronous::details::PartitionWalker<std::vector<int>::iterator>;
+
+    Walker walker(numbers.begin(), numbers.size(), 4, asynchronous::guided(10));
+
+    std::vector<long> sizes;
+    walker.walk([&sizes](const Walker::Range& range) { sizes.push_back(range.last - range.first); });
+
+    EXPECT_EQ( 250, sizes.front() );
+    EXPECT_TRUE( std::is_sorted(sizes.rbegin(), sizes.rend()) );
+    EXPECT_EQ( 1000, std::accumulate(sizes.begin(), sizes.end(), 0L) );
+}   // TEST guided_shrinks
+
+TEST( Test_partition, invoke_on_each )
+{
+    std::vector<int> numbers(100);
+    std::iota(numbers.begin(), numbers.end(), 0);
+
+    auto results = asynchronous::invoke_on_each(4, asynchronous::static_chunk(8), numbers,
+                                                [](int a) { return 2*a; });
+
+    ASSERT_EQ( numbers.size(), results.size() );
+
+    int expected = 0;
+    for(auto& result : results)
+    {
+        EXPECT_EQ( expected, result->get() );
+        expected += 2;
+    }
+}   // TEST invoke_on_each
+
+//******************************************************************************
+// EOF
+//******************************************************************************
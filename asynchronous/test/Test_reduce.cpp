@@ -0,0 +1,116 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/reduce.hpp"
+
+#include <cstring>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+TEST( Test_reduce, sum )
+{
+    std::vector<int> numbers(1000);
+    std::iota(numbers.begin(), numbers.end(), 1);
+
+    EXPECT_EQ( 500500, asynchronous::reduce(4, numbers, 0) );
+    EXPECT_EQ( 500500, asynchronous::reduce(1, numbers, 0) );
+    EXPECT_EQ( 500510, asynchronous::reduce(3, numbers, 10) );
+}   // TEST sum
+
+TEST( Test_reduce, transform )
+{
+    const std::vector<int> numbers = { 1,2,3,4,5 };
+
+    auto sum = asynchronous::transform_reduce(2, numbers, 0,
+                                              std::plus<>{},
+                                              [](int a) { return a*a; });
+    EXPECT_EQ( 55, sum );
+}   // TEST transform
+
+TEST( Test_reduce, list )
+{
+    const std::list<std::string> words = { "a", "b", "c", "d" };
+
+    // concatenation is not commutative, but it is associative
+    // so with the deterministic order the result keeps the element order
+    auto text = asynchronous::reduce(3, words, std::string{">"},
+                                     std::plus<>{},
+                                     asynchronous::ReduceOrder::deterministic);
+    EXPECT_EQ( ">abcd", text );
+}   // TEST list
+
+TEST( Test_reduce, deterministic )
+{
+    std::vector<double> numbers(100000);
+    for(size_t i = 0; i < numbers.size(); ++i)
+    { numbers[i] = 1.0 / static_cast<double>(i+1); }
+
+    const auto order = asynchronous::ReduceOrder::deterministic;
+    const auto expected = asynchronous::reduce(1, numbers, 0.0, std::plus<>{}, order);
+
+    // the grouping of the additions does not depend on the thread count
+    for(size_t threadCount = 2; threadCount < 8; ++threadCount)
+    {
+        const auto sum = asynchronous::reduce(threadCount, numbers, 0.0, std::plus<>{}, order);
+        EXPECT_EQ( 0, std::memcmp(&expected, &sum, sizeof(sum)) ) << threadCount;
+    }
+}   // TEST deterministic
+
+TEST( Test_reduce, empty )
+{
+    const std::vector<int> numbers;
+
+    EXPECT_EQ( 42, asynchronous::reduce(4, numbers, 42) );
+    EXPECT_EQ( 42, asynchronous::reduce(0, numbers, 42) );
+}   // TEST empty
+
+TEST( Test_reduce, zeroThreads )
+{
+    const std::vector<int> numbers = { 1,2,3 };
+
+    EXPECT_THROW( asynchronous::reduce(0, numbers, 0), std::invalid_argument );
+}   // TEST zeroThreads
+
+TEST( Test_reduce, exception )
+{
+    std::vector<int> numbers(100, 1);
+    numbers[42] = 0;
+
+    auto invert = [](int a)
+    {
+        if (a == 0) { throw std::domain_error("division by zero"); }
+        return 1.0 / a;
+    };
+
+    EXPECT_THROW( asynchronous::transform_reduce(4, numbers, 0.0, std::plus<>{}, invert),
+                  std::domain_error );
+}   // TEST exception
+
+//******************************************************************************
+// EOF
+//******************************************************************************
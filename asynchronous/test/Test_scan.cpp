@@ -0,0 +1,105 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/scan.hpp"
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+static std::vector<long> getNumbers(size_t count)
+{
+    std::vector<long> result(count);
+    for(size_t i = 0; i < count; ++i) { result[i] = static_cast<long>(i % 17) - 8; }
+    return result;
+}
+
+TEST( Test_scan, inclusive )
+{
+    const auto numbers = getNumbers(100000);
+    std::vector<long> expected(numbers.size());
+    std::inclusive_scan(numbers.begin(), numbers.end(), expected.begin());
+
+    for(size_t threadCount : { 1, 2, 3, 8 })
+    {
+        std::vector<long> result(numbers.size());
+        auto end = asynchronous::inclusive_scan(threadCount, numbers.begin(), numbers.end(), result.begin());
+
+        EXPECT_EQ( result.end(), end );
+        EXPECT_EQ( expected, result ) << threadCount;
+    }
+}   // TEST inclusive
+
+TEST( Test_scan, exclusive )
+{
+    const auto numbers = getNumbers(100000);
+    std::vector<long> expected(numbers.size());
+    std::exclusive_scan(numbers.begin(), numbers.end(), expected.begin(), 42L);
+
+    for(size_t threadCount : { 1, 2, 3, 8 })
+    {
+        std::vector<long> result(numbers.size());
+        auto end = asynchronous::exclusive_scan(threadCount, numbers.begin(), numbers.end(), result.begin(), 42L);
+
+        EXPECT_EQ( result.end(), end );
+        EXPECT_EQ( expected, result ) << threadCount;
+    }
+}   // TEST exclusive
+
+TEST( Test_scan, inplace )
+{
+    auto numbers = getNumbers(50000);
+    auto expected = numbers;
+    std::inclusive_scan(expected.begin(), expected.end(), expected.begin(), std::bit_xor<>{});
+
+    asynchronous::inclusive_scan(4, numbers.begin(), numbers.end(), numbers.begin(), std::bit_xor<>{});
+
+    EXPECT_EQ( expected, numbers );
+}   // TEST inplace
+
+TEST( Test_scan, not_commutative )
+{
+    const std::vector<std::string> letters(20000, "a");
+    std::vector<std::string> result(letters.size());
+
+    asynchronous::exclusive_scan(4, letters.begin(), letters.end(), result.begin(), std::string{">"});
+
+    EXPECT_EQ( ">", result.front() );
+    EXPECT_EQ( ">" + std::string(letters.size()-1, 'a'), result.back() );
+}   // TEST not_commutative
+
+TEST( Test_scan, empty )
+{
+    const std::vector<int> numbers;
+    std::vector<int> result;
+
+    EXPECT_EQ( result.begin(), asynchronous::inclusive_scan(4, numbers.begin(), numbers.end(), result.begin()) );
+    EXPECT_EQ( result.begin(), asynchronous::exclusive_scan(4, numbers.begin(), numbers.end(), result.begin(), 0) );
+}   // TEST empty
+
+//******************************************************************************
+// EOF
+//******************************************************************************
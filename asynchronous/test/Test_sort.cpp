@@ -0,0 +1,124 @@
+/* begin copyright
+
+   IBM Confidential
+
+   Licensed Internal Code Source Materials
+
+   3931, 3932 Licensed Internal Code
+
+   (C) Copyright IBM Corp. 2019, 2026
+
+   The source code for this program is not published or otherwise
+   divested of its trade secrets, irrespective of what has
+   been deposited with the U.S. Copyright Office.
+
+   end copyright
+*/
+
+//******************************************************************************
+// Created on: Oct 18, 2026
+//     Author: oelsnerc
+//******************************************************************************
+
+#include "asynchronous/sort.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+#include <gtest/gtest.h>
+
+//******************************************************************************
+static std::vector<int> getRandomNumbers(size_t count)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(-1000, 1000);
+
+    std::vector<int> result(count);
+    for(auto& number : result) { number = distribution(generator); }
+    return result;
+}
+
+TEST( Test_sort, small )
+{
+    std::vector<int> numbers = { 5,3,1,4,2 };
+
+    asynchronous::sort(4, numbers);
+
+    EXPECT_EQ( (std::vector<int>{1,2,3,4,5}), numbers );
+}   // TEST small
+
+TEST( Test_sort, random )
+{
+    for(size_t threadCount : { 1, 2, 3, 4, 7, 8 })
+    {
+        auto numbers = getRandomNumbers(100000);
+        auto expected = numbers;
+        std::sort(expected.begin(), expected.end());
+
+        asynchronous::sort(threadCount, numbers.begin(), numbers.end());
+
+        EXPECT_EQ( expected, numbers ) << threadCount;
+    }
+}   // TEST random
+
+TEST( Test_sort, compare )
+{
+    auto numbers = getRandomNumbers(50000);
+    std::vector<std::string> texts;
+    texts.reserve(numbers.size());
+    for(auto number : numbers) { texts.push_back(std::to_string(number)); }
+
+    auto expected = texts;
+    std::sort(expected.begin(), expected.end(), std::greater<>{});
+
+    asynchronous::sort(5, texts, std::greater<>{});
+
+    EXPECT_EQ( expected, texts );
+}   // TEST compare
+
+TEST( Test_sort, empty )
+{
+    std::vector<int> numbers;
+
+    asynchronous::sort(4, numbers);
+
+    EXPECT_TRUE( numbers.empty() );
+}   // TEST empty
+
+/**
+ * This "test" compares the parallel sort with std::sort
+ * NOTE: disabled, because it takes a while and only prints the timings
+ *       run it with --gtest_also_run_disabled_tests
+ */
+TEST( Test_sort, DISABLED_benchmark )
+{
+    using clock = std::chrono::steady_clock;
+    using ms = std::chrono::duration<double, std::milli>;
+
+    const auto numbers = getRandomNumbers(1 << 24);
+    const size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    auto data = numbers;
+    auto start = clock::now();
+    std::sort(data.begin(), data.end());
+    std::cout << "std::sort          : " << ms(clock::now() - start).count() << " ms" << std::endl;
+
+    for(size_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+    {
+        data = numbers;
+        start = clock::now();
+        asynchronous::sort(threadCount, data);
+        std::cout << "asynchronous::sort : " << ms(clock::now() - start).count() << " ms"
+                  << " on " << threadCount << " threads" << std::endl;
+    }
+}   // TEST benchmark
+
+//******************************************************************************
+// EOF
+//******************************************************************************
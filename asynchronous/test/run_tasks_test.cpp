@@ -51,6 +51,15 @@ public:
         return ivMap.size();
     }
 
+    size_t getTicks() const {
+        auto lck = getLock();
+        size_t result = 0;
+        for(auto & p : ivMap) {
+            result += static_cast<size_t>(p.second);
+        }
+        return result;
+    }
+
     asynchronous::Tasks makeTasks(size_t count) {
         asynchronous::Tasks tasks;
         tasks.reserve(count);
@@ -91,6 +100,21 @@ TEST_F(run_tasks_test, moreTasksThanThreads) {
     SCOPED_TRACE(*this);
 }
 
+TEST_F(run_tasks_test, staticPartition) {
+
+    constexpr size_t maxTasks   = 120;
+    constexpr size_t maxThreads =   4;
+
+    auto tasks = makeTasks(maxTasks);
+
+    EXPECT_NO_THROW( asynchronous::run_tasks(tasks, maxThreads, asynchronous::static_chunk(10)) );
+
+    EXPECT_EQ(maxTasks, getTicks()); // every task has been called exactly once
+    EXPECT_GE(maxThreads, getThreads());
+
+    SCOPED_TRACE(*this);
+}
+
 TEST_F(run_tasks_test, moreThreadsThanTasks) {
 
     constexpr size_t maxTasks   =   4;